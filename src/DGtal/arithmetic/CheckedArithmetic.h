@@ -0,0 +1,167 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file CheckedArithmetic.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module CheckedArithmetic.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(CheckedArithmetic_RECURSES)
+#error Recursive header files inclusion detected in CheckedArithmetic.h
+#else // defined(CheckedArithmetic_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define CheckedArithmetic_RECURSES
+
+#if !defined CheckedArithmetic_h
+/** Prevents repeated inclusion of headers. */
+#define CheckedArithmetic_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PromotedInteger
+  /**
+     Description of template class 'PromotedInteger' <p> \brief Aim:
+     Gives an integer type able to hold exactly the product of two
+     integers of type TInteger (and the sum of two such products).
+
+     - DGtal::int32_t is promoted to DGtal::int64_t,
+     - DGtal::int64_t is promoted to DGtal::int128_t when the compiler
+       provides 128-bit integers (WITH_INT128), otherwise to
+       DGtal::BigInteger (WITH_BIGINTEGER), otherwise it is not
+       promoted.
+     - other types are not promoted.
+
+     @tparam TInteger any integer type.
+   */
+  template <typename TInteger>
+  struct PromotedInteger
+  {
+    /// The promoted type.
+    typedef TInteger Type;
+  };
+
+  template <>
+  struct PromotedInteger<DGtal::int32_t>
+  {
+    typedef DGtal::int64_t Type;
+  };
+
+  template <>
+  struct PromotedInteger<DGtal::int64_t>
+  {
+#if defined(WITH_INT128)
+    typedef DGtal::int128_t Type;
+#elif defined(WITH_BIGINTEGER)
+    typedef DGtal::BigInteger Type;
+#else
+    typedef DGtal::int64_t Type;
+#endif
+  };
+
+  namespace functions
+  {
+    /**
+       Adds two 64-bit integers and tells if the result overflowed.
+
+       @param a any integer.
+       @param b any integer.
+       @param[out] r the sum of @a a and @a b modulo 2^64.
+       @return 'true' iff the sum is not representable by DGtal::int64_t.
+    */
+    bool addOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+
+    /**
+       Subtracts two 64-bit integers and tells if the result overflowed.
+
+       @param a any integer.
+       @param b any integer.
+       @param[out] r the difference @a a - @a b modulo 2^64.
+       @return 'true' iff the difference is not representable by DGtal::int64_t.
+    */
+    bool subOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+
+    /**
+       Multiplies two 64-bit integers and tells if the result overflowed.
+
+       @param a any integer.
+       @param b any integer.
+       @param[out] r the product of @a a and @a b modulo 2^64.
+       @return 'true' iff the product is not representable by DGtal::int64_t.
+    */
+    bool mulOverflow( DGtal::int64_t a, DGtal::int64_t b, DGtal::int64_t & r );
+
+    /**
+       Exact sign of a*b - c*d, i.e. of the 2x2 determinant of
+       columns (a,c) and (d,b). It is computed with 64-bit arithmetic
+       as long as nothing overflows, and is only promoted to 128-bit
+       arithmetic (or to the overflow-free method of
+       AvnaimEtAl2x2DetSignComputer without 128-bit integers) on
+       overflow.
+
+       @param a any integer.
+       @param b any integer.
+       @param c any integer.
+       @param d any integer.
+       @return 1, 0 or -1, the sign of a*b - c*d.
+    */
+    int productDifferenceSign( DGtal::int64_t a, DGtal::int64_t b,
+                               DGtal::int64_t c, DGtal::int64_t d );
+
+    /**
+       Exact value of a*b - c*d, computed with 64-bit arithmetic as
+       long as nothing overflows, and with the promoted type otherwise.
+
+       @param a any integer.
+       @param b any integer.
+       @param c any integer.
+       @param d any integer.
+       @return a*b - c*d.
+       @pre the result is representable by PromotedInteger<DGtal::int64_t>::Type.
+    */
+    PromotedInteger<DGtal::int64_t>::Type
+    productDifference( DGtal::int64_t a, DGtal::int64_t b,
+                       DGtal::int64_t c, DGtal::int64_t d );
+
+  } // namespace functions
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/CheckedArithmetic.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined CheckedArithmetic_h
+
+#undef CheckedArithmetic_RECURSES
+#endif // else defined(CheckedArithmetic_RECURSES)
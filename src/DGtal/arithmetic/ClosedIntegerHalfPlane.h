@@ -43,6 +43,7 @@
 #include <iostream>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CSpace.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -100,10 +101,27 @@ namespace DGtal
        @param A any point.
        @param B any point different from A.
        @param inP any point not on the straight line (AB).
+       @tparam TIntegerComputer the type of integer computer, e.g.
+       IntegerComputer<Integer> or NativeIntegerComputer<Integer>.
        @param ic any compatible integer computer.
      */
+    template <typename TIntegerComputer>
     ClosedIntegerHalfPlane( const Point & A, const Point & B, 
-                            const Point & inP, IntegerComputer<Integer> & ic );
+                            const Point & inP, const TIntegerComputer & ic );
+
+    /**
+       Constructor. Computes the half-space of the form N.P<=c whose
+       supporting line passes through A and B such that the point \a
+       inP satisfies the constraint. The computations are done with
+       the integer computer chosen by IntegerComputerSelector, hence
+       without any shared state for native integers.
+       
+       @param A any point.
+       @param B any point different from A.
+       @param inP any point not on the straight line (AB).
+     */
+    ClosedIntegerHalfPlane( const Point & A, const Point & B, 
+                            const Point & inP );
 
     /**
        @param p any point in the plane.
@@ -75,7 +75,8 @@ boost::DefaultConstructible, boost::Assignable. All its member data are
 It is a backport of \e ImaGene.
 
 @tparam TInteger any model of integer (CInteger), like \c int, \c long int,
-\c int64_t, \c BigInteger (when GMP is installed).
+\c int64_t, \c int128_t (when the compiler provides it), \c BigInteger
+(when GMP is installed).
    
    */
   template <typename TInteger>
@@ -49,6 +49,7 @@
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 #include "DGtal/arithmetic/ClosedIntegerHalfPlane.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -93,7 +94,7 @@ namespace DGtal
     typedef typename Space::Integer Integer;
     typedef typename Space::Point Point;
     typedef typename Space::Vector Vector;
-    typedef IntegerComputer<Integer> MyIntegerComputer;
+    typedef typename IntegerComputerSelector<Integer>::Type MyIntegerComputer;
     typedef HyperRectDomain< Space > Domain; 
     typedef ClosedIntegerHalfPlane< Space > HalfSpace;
 
@@ -530,7 +531,8 @@ namespace DGtal
   private:
     /// A utility object to perform computation on integers. Need not
     /// to be copied when cloning this object. Avoids many dynamic
-    /// allocations when using big integers.
+    /// allocations when using big integers. It is a stateless
+    /// NativeIntegerComputer for native integers.
     mutable MyIntegerComputer _ic;
     mutable Integer _a, _b, _c, _c1, _c3, _den, _g, _fl, _ce;
     mutable Point _A, _B, _A1, _B1, _A2, _B2;
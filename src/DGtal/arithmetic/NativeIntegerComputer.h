@@ -0,0 +1,476 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file NativeIntegerComputer.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module NativeIntegerComputer.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(NativeIntegerComputer_RECURSES)
+#error Recursive header files inclusion detected in NativeIntegerComputer.h
+#else // defined(NativeIntegerComputer_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define NativeIntegerComputer_RECURSES
+
+#if !defined NativeIntegerComputer_h
+/** Prevents repeated inclusion of headers. */
+#define NativeIntegerComputer_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/if.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class NativeIntegerComputer
+  /**
+Description of template class 'NativeIntegerComputer' <p> \brief Aim:
+This class provides the services of IntegerComputer for native
+(i.e. bounded) integer types, without any member data.
+
+IntegerComputer keeps mutable temporaries so as to limit the
+allocations of big integers, which forces each thread (and in
+practice each object) to own an instance. With native integers these
+temporaries are useless: this class has no state, all its methods
+are static and may be called concurrently. The simplest ones (gcd,
+floor and ceil divisions, ...) are \c constexpr, the others only use
+local variables (the extended Euclid algorithm and the computation of
+convergents do not fill vectors).
+
+It has exactly the interface of IntegerComputer, so that it can be
+used in place of it. The class IntegerComputerSelector chooses at
+compile time the appropriate computer for a given integer type.
+
+It is a model of boost::CopyConstructible,
+boost::DefaultConstructible, boost::Assignable.
+
+@tparam TInteger any bounded model of integer (CInteger), like \c
+int, \c long int, \c int64_t, \c int128_t (when the compiler provides
+it).
+
+@see IntegerComputer, IntegerComputerSelector
+   */
+  template <typename TInteger>
+  class NativeIntegerComputer
+  {
+    // ----------------------- Associated types ------------------------------
+  public:
+    typedef NativeIntegerComputer<TInteger> Self;
+    typedef typename NumberTraits<TInteger>::SignedVersion Integer;
+    typedef typename NumberTraits<Integer>::ParamType IntegerParamType;
+
+    typedef typename NumberTraits<TInteger>::UnsignedVersion UnsignedInteger;
+    typedef typename NumberTraits<UnsignedInteger>::ParamType UnsignedIntegerParamType;
+
+    typedef typename SpaceND<2,Integer>::Point Point2I;
+    typedef typename SpaceND<2,Integer>::Vector Vector2I;
+    typedef typename SpaceND<3,Integer>::Point Point3I;
+    typedef typename SpaceND<3,Integer>::Vector Vector3I;
+
+    BOOST_CONCEPT_ASSERT((concepts::CInteger<Integer>));
+    BOOST_STATIC_ASSERT(( boost::is_same< typename NumberTraits<Integer>::IsBounded,
+                          TagTrue >::value ));
+
+    // ----------------------- Integer services ------------------------------
+  public:
+
+    /**
+       @param a any integer.
+       @return true if a == 0.
+     */
+    static constexpr bool isZero( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return true if a != 0.
+     */
+    static constexpr bool isNotZero( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return true if a > 0.
+     */
+    static constexpr bool isPositive( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return true if a < 0.
+     */
+    static constexpr bool isNegative( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return true if a >= 0.
+     */
+    static constexpr bool isPositiveOrZero( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return true if a <= 0.
+     */
+    static constexpr bool isNegativeOrZero( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @return its absolute value.
+     */
+    static constexpr Integer abs( IntegerParamType a );
+
+    /**
+       @param a any integer.
+       @param b any integer.
+       @return the maximum value of \a a and \a b.
+     */
+    static constexpr Integer max( IntegerParamType a, IntegerParamType b );
+
+    /**
+       @param a any integer.
+       @param b any integer.
+       @param c any integer.
+       @return the maximum value of \a a, \a b and \a c.
+     */
+    static constexpr Integer max( IntegerParamType a, IntegerParamType b, IntegerParamType c );
+
+    /**
+       @param a any integer.
+       @param b any integer.
+       @return the minimum value of \a a and \a b.
+     */
+    static constexpr Integer min( IntegerParamType a, IntegerParamType b );
+
+    /**
+       @param a any integer.
+       @param b any integer.
+       @param c any integer.
+       @return the minimum value of \a a, \a b and \a c.
+     */
+    static constexpr Integer min( IntegerParamType a, IntegerParamType b, IntegerParamType c );
+
+    /**
+       Computes the euclidean division of a/b, returning quotient and
+       remainder.
+
+       @param q (returns) the quotient of a/b.
+       @param r (returns) the remainder of a/b.
+       @param a any integer.
+       @param b any non-null integer.
+     */
+    static void getEuclideanDiv( Integer & q, Integer & r,
+                                 IntegerParamType a, IntegerParamType b );
+
+    /**
+       Computes the floor value of na/nb.
+       @param na any integer.
+       @param nb any non-null integer.
+       @return the floor value of na/nb.
+     */
+    static constexpr Integer floorDiv( IntegerParamType na, IntegerParamType nb );
+
+    /**
+       Computes the ceil value of na/nb.
+       @param na any integer.
+       @param nb any non-null integer.
+       @return the ceil value of na/nb.
+     */
+    static constexpr Integer ceilDiv( IntegerParamType na, IntegerParamType nb );
+
+    /**
+       Computes the floor and ceil value of na/nb.
+       @param fl (returns) the floor value of na/nb.
+       @param ce (returns) the ceil value of na/nb.
+       @param na any integer.
+       @param nb any non-null integer.
+     */
+    static void getFloorCeilDiv( Integer & fl, Integer & ce,
+                                 IntegerParamType na, IntegerParamType nb );
+
+    /**
+       Returns the greatest common divisor of \a a and \a b (\a a and \a b may be
+       either positive or negative).
+       @param a any integer.
+       @param b any integer.
+       @return the gcd of \a a and \a b.
+     */
+    static constexpr Integer staticGcd( IntegerParamType a, IntegerParamType b );
+
+    /**
+       Returns the greatest common divisor of \a a and \a b (\a a and \a b may be
+       either positive or negative).
+       @param a any integer.
+       @param b any integer.
+       @return the gcd of \a a and \a b.
+     */
+    static constexpr Integer gcd( IntegerParamType a, IntegerParamType b );
+
+    /**
+       Returns the greatest common divisor of \a a and \a b (\a a and \a b may be
+       either positive or negative).
+       @param g (returns) the gcd of \a a and \a b.
+       @param a any integer.
+       @param b any integer.
+    */
+    static void getGcd( Integer & g, IntegerParamType a, IntegerParamType b );
+
+    /**
+       Computes and push_backs the simple continued fraction of a / b.
+       @param quotients (modifies) adds to the back of the vector the quotients of the continued fraction of a/b.
+       @param a any positive integer.
+       @param b any positive integer.
+       @return the gcd of \a a and \a b.
+       @see IntegerComputer::getCFrac
+    */
+    static Integer getCFrac( std::vector<Integer> & quotients,
+                             IntegerParamType a, IntegerParamType b );
+
+    /**
+       Computes and outputs the quotients of the simple continued
+       fraction of a / b.
+       @tparam OutputIterator a model of boost::OutputIterator
+       @param outIt an instance of output iterator that is used to
+       write the successive quotients of the continued fraction of
+       a/b.
+       @param a any positive integer.
+       @param b any positive integer.
+       @return the gcd of \a a and \a b.
+    */
+    template <typename OutputIterator>
+    static Integer getCFrac( OutputIterator outIt,
+                             IntegerParamType a, IntegerParamType b );
+
+    /**
+       Returns the k-th principal convergent of the fraction
+       corresponding to the given quotients.
+       @param quotients the sequence of partial quotients.
+       @param k the desired partial convergent.
+       @return the corresponding fraction p_k / q_k as a point (p_k, q_k).
+       @see IntegerComputer::convergent
+    */
+    static Point2I convergent( const std::vector<Integer> & quotients,
+                               unsigned int k );
+
+    // ----------------------- Point2I services ------------------------------
+  public:
+
+    /**
+       Makes \a p irreducible.
+       @param p any vector in Z2.
+     */
+    static void reduce( Vector2I & p );
+
+    /**
+       @param u any vector in Z2.
+       @param v any vector in Z2.
+       @return the cross product of \a u and \a v.
+    */
+    static Integer crossProduct( const Vector2I & u, const Vector2I & v );
+
+    /**
+       @param cp (returns) the cross product of \a u and \a v.
+       @param u any vector in Z2.
+       @param v any vector in Z2.
+     */
+    static void getCrossProduct( Integer & cp,
+                                 const Vector2I & u, const Vector2I & v );
+
+    /**
+       @param u any vector in Z2.
+       @param v any vector in Z2.
+       @return the dot product of \a u and \a v.
+     */
+    static Integer dotProduct( const Vector2I & u, const Vector2I & v );
+
+    /**
+       @param dp (returns) the dot product of \a u and \a v.
+       @param u any vector in Z2.
+       @param v any vector in Z2.
+     */
+    static void getDotProduct( Integer & dp,
+                               const Vector2I & u, const Vector2I & v );
+
+    /**
+       Returns a solution of the Diophantine equation: a x + b y =
+       c. It is the solution returned by IntegerComputer::extendedEuclid.
+
+       @param a any non-null integer.
+       @param b any non-null integer.
+       @param c any integer multiple of gcd(|a|,|b|).
+       @return a vector (x,y) solution to a x + b y = c.
+       @see IntegerComputer::extendedEuclid
+     */
+    static Vector2I extendedEuclid( IntegerParamType a, IntegerParamType b,
+                                    IntegerParamType c );
+
+    /**
+       Computes the floor (fl) and the ceiling (ce) value of the real
+       number k such that p + k u lies on the supporting line of the
+       linear constraint N.p <= c.
+       @param fl the greatest integer such that (u.N) fl <= c - p.N
+       @param ce the smallest integer such that c - p.N  < (u.N) ce
+       @param p any vector in Z2
+       @param u any vector in Z2 in the same quadrant as N.
+       @param N any vector in Z2 in the same quadrant as u.
+       @param c any integer.
+       @see IntegerComputer::getCoefficientIntersection
+     */
+    static void getCoefficientIntersection( Integer & fl, Integer & ce,
+                                            const Vector2I & p,
+                                            const Vector2I & u,
+                                            const Vector2I & N,
+                                            IntegerParamType c );
+
+    /**
+       Compute the valid bezout vector v of u such that A+v satifies
+       the constraints C2 and such that A+v+u doesn't satify the
+       constraint C2.
+       @param v (modifies) a Bezout vector for u, with the constraints above.
+       @param A any point in Z2.
+       @param u any vector in Z2.
+       @param N any vector in Z2, defining the first constraint.
+       @param c the integer for the first constraint.
+       @param N2 any vector in Z2, defining the second constraint.
+       @param c2 the integer for the second constraint.
+       @param compute_v tells if v should be recomputed (true) or is
+       already given (false), default to true.
+       @see IntegerComputer::getValidBezout
+     */
+    static void getValidBezout ( Vector2I & v,
+                                 const Point2I & A, const Vector2I & u,
+                                 const Vector2I & N, IntegerParamType c,
+                                 const Vector2I & N2, IntegerParamType c2,
+                                 bool compute_v = true );
+
+    // ----------------------- Point3I services ------------------------------
+  public:
+
+    /**
+       Makes \a p irreducible.
+       @param p any vector in Z3.
+     */
+    static void reduce( Vector3I & p );
+
+    /**
+       @param u any vector in Z3.
+       @param v any vector in Z3.
+       @return the dot product of \a u and \a v.
+     */
+    static Integer dotProduct( const Vector3I & u, const Vector3I & v );
+
+    /**
+       @param dp (returns) the dot product of \a u and \a v.
+       @param u any vector in Z3.
+       @param v any vector in Z3.
+     */
+    static void getDotProduct( Integer & dp,
+                               const Vector3I & u, const Vector3I & v );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       @param a any non-negative integer.
+       @param b any non-negative integer.
+       @return the gcd of \a a and \a b.
+    */
+    static constexpr Integer positiveGcd( IntegerParamType a, IntegerParamType b );
+
+  }; // end of class NativeIntegerComputer
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'NativeIntegerComputer'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'NativeIntegerComputer' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const NativeIntegerComputer<TInteger> & object );
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IntegerComputerSelector
+  /**
+     Description of template class 'IntegerComputerSelector' <p>
+     \brief Aim: Chooses at compile time the integer computer adapted
+     to some integer type: NativeIntegerComputer for bounded integral
+     types (according to NumberTraits), IntegerComputer otherwise
+     (e.g. for BigInteger).
+
+     @code
+     typedef IntegerComputerSelector<Integer>::Type MyIntegerComputer;
+     @endcode
+
+     @tparam TInteger any model of integer (CInteger).
+   */
+  template <typename TInteger>
+  struct IntegerComputerSelector
+  {
+    typedef typename NumberTraits<TInteger>::SignedVersion Integer;
+    /// The chosen integer computer.
+    typedef typename boost::mpl::if_c<
+      boost::is_same< typename NumberTraits<Integer>::IsBounded, TagTrue >::value
+      && boost::is_same< typename NumberTraits<Integer>::IsIntegral, TagTrue >::value,
+      NativeIntegerComputer<TInteger>,
+      IntegerComputer<TInteger> >::type Type;
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/NativeIntegerComputer.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined NativeIntegerComputer_h
+
+#undef NativeIntegerComputer_RECURSES
+#endif // else defined(NativeIntegerComputer_RECURSES)
@@ -44,6 +44,9 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <atomic>
+#include <mutex>
+#include <cstddef>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/InputIteratorWithRankOnSequence.h"
 #include "DGtal/kernel/CInteger.h"
@@ -63,9 +66,24 @@ namespace DGtal
    the structure of this tree is a coding of the continued fraction
    representation of fractions.
 
-   This class is not to be instantiated, since it is useless to
-   duplicate it. Use static method SternBrocot::fraction to obtain
-   your fractions.
+   There is usually no need to instantiate this class, since it is
+   useless to duplicate the tree. Use static method
+   SternBrocot::fraction to obtain your fractions, which lie in the
+   shared tree SternBrocot::instance().
+
+   The tree is thread-safe: nodes are created with an atomic
+   compare-and-swap on the descendant pointers of their father, so
+   that several threads may navigate and extend the same tree
+   concurrently without locking. Nodes are allocated in an arena
+   owned by the tree and are all released when the tree is
+   destroyed.
+
+   When memory must remain bounded (e.g. in a long-running service),
+   independent trees may be instantiated, for instance one per thread
+   or one per task, and their fractions obtained through
+   localFraction(), localZeroOverOne() or localOneOverZero(). All the
+   fractions descending from them belong to the same tree, and are
+   valid as long as it lives.
 
    @tparam TInteger the integral type chosen for the fractions.
 
@@ -130,11 +148,13 @@ namespace DGtal
       /// the node that is the right ascendant.
       Node* ascendantRight;
       /// the node that is the left descendant or 0 (if none exist).
-      Node* descendantLeft;
+      std::atomic<Node*> descendantLeft;
       /// the node that is the right descendant or 0 (if none exist).
-      Node* descendantRight;
+      std::atomic<Node*> descendantRight;
       /// the node that is its inverse.
       Node* inverse;
+      /// the tree owning this node.
+      Self* tree;
     };
 
     /**
@@ -162,6 +182,7 @@ namespace DGtal
       typedef const value_type & const_reference;
 
     private:
+      friend class SternBrocot<TInteger, TQuotient>;
       Node* myNode; 
 
     public:
@@ -173,7 +194,8 @@ namespace DGtal
           @param aQ the denominator (>=0)
           
           @param ancestor (optional) any ancestor of aP/aQ in the tree
-          (for speed-up).
+          (for speed-up). The fraction is built in the tree of \a
+          ancestor, hence in the shared tree by default.
           
           Construct the corresponding fraction in the Stern-Brocot tree.
           
@@ -289,6 +311,19 @@ namespace DGtal
       */         
       void pushBack( const std::pair<Quotient, Quotient> & quotient );
 
+    private:
+      /**
+         Same as pushBack( quotient ), except that a null fraction
+         starts in the given tree.
+
+         @param quotient the pair \f$(m,k+1)\f$.
+         @param tree the tree of the fraction when this fraction is null.
+      */
+      void pushBack( const std::pair<Quotient, Quotient> & quotient,
+                     const SternBrocotTree & tree );
+
+    public:
+
       /**
 	 Splitting formula, O(1) time complexity. This fraction should
 	 not be 0/1 or 1/0. NB: 'this' = [f1] @f$\oplus@f$ [f2].
@@ -407,12 +442,36 @@ namespace DGtal
   public:
 
     /**
-     * Destructor.
+     * Constructor of an independent tree, containing initially the
+     * fractions 0/1, 1/0 and 1/1. Most users should use the shared
+     * tree instance() instead.
+     */
+    SternBrocot();
+
+    /**
+     * Destructor. Releases all the nodes of the tree: the fractions
+     * of this tree are no longer valid afterwards.
      */
     ~SternBrocot();
 
     /**
-       @return the (only) instance of SternBrocot.
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden.
+     */
+    SternBrocot ( const SternBrocot & other ) = delete;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden.
+     */
+    SternBrocot & operator= ( const SternBrocot & other ) = delete;
+
+    /**
+       @return the shared instance of SternBrocot (thread-safe
+       initialization).
     */
     static SternBrocot & instance();
 
@@ -440,6 +499,21 @@ namespace DGtal
     static Fraction fraction( Integer p, Integer q,
                               Fraction ancestor = zeroOverOne() );
 
+    /** The fraction 0/1 of this tree. */
+    Fraction localZeroOverOne() const;
+
+    /** The fraction 1/0 of this tree. */
+    Fraction localOneOverZero() const;
+
+    /**
+       Any fraction p/q of this tree, see fraction.
+
+       @param p the numerator (>=0)
+       @param q the denominator (>=0)
+       @return the corresponding fraction in this tree.
+    */
+    Fraction localFraction( Integer p, Integer q ) const;
+
     // ----------------------- Interface --------------------------------------
   public:
 
@@ -456,42 +530,79 @@ namespace DGtal
      */
     bool isValid() const;
 
-    /// The total number of fractions in the current tree.
+    /// The total number of fractions in the current tree (updated
+    /// under a lock when the tree grows).
     Quotient nbFractions;
 
     // ------------------------- Protected Datas ------------------------------
   private:
+
+    /**
+       Arena of nodes. Nodes are stored in chunks of geometrically
+       increasing sizes, whose addresses never change. A slot is
+       reserved with an atomic increment and chunks are installed
+       with a compare-and-swap, so that allocation is lock-free.
+       Nodes that were never published (e.g. by a thread losing a
+       race to create a child) are given back with release and
+       reused by the next creations; all nodes are freed with the
+       arena.
+    */
+    class NodePool {
+    public:
+      NodePool();
+      ~NodePool();
+      NodePool( const NodePool & other ) = delete;
+      NodePool & operator=( const NodePool & other ) = delete;
+
+      /**
+         Constructs a new node in the arena, see Node::Node.
+         @return the new node.
+      */
+      Node* create( Integer p1, Integer q1, Quotient u1, Quotient k1,
+                    Node* ascendant_left1, Node* ascendant_right1,
+                    Node* descendant_left1, Node* descendant_right1,
+                    Node* inverse1, Self* tree1 );
+
+      /**
+         Gives back a node that was never published, so that it is
+         reused by a later call to create.
+         @param n a node returned by create.
+      */
+      void release( Node* n );
+
+      /// @return the number of nodes constructed in the arena.
+      std::size_t size() const;
+
+    private:
+      /// @return a new slot of the arena, where a node must be constructed.
+      Node* reserve();
+
+      /// Number of nodes of the first chunk.
+      static const std::size_t FirstChunkSize = 256;
+      /// Maximal number of chunks.
+      static const unsigned int NbChunks = 48;
+      /// Number of reserved slots.
+      std::atomic<std::size_t> myNext;
+      /// Chunks of nodes, chunk c has FirstChunkSize*2^c slots.
+      std::atomic<Node*> myChunks[ NbChunks ];
+      /// Protects myFreeNodes.
+      std::mutex myFreeMutex;
+      /// Released nodes, to be reused.
+      std::vector<Node*> myFreeNodes;
+      /// Number of released nodes, checked before taking the lock.
+      std::atomic<std::size_t> myNbFreeNodes;
+    };
+
     // ------------------------- Private Datas --------------------------------
   private:
-    /// Singleton class.
-    static SternBrocot* singleton;
+    /// The nodes of the tree.
+    NodePool myPool;
 
     Node* myZeroOverOne;
     Node* myOneOverZero;
     Node* myOneOverOne;
-
-    // ------------------------- Hidden services ------------------------------
-  private:
-
-    /**
-     * Constructor. Hidden since singleton class.
-     */
-    SternBrocot();
-
-    /**
-     * Copy constructor.
-     * @param other the object to clone.
-     * Forbidden by default.
-     */
-    SternBrocot ( const SternBrocot & other );
-
-    /**
-     * Assignment.
-     * @param other the object to copy.
-     * @return a reference on 'this'.
-     * Forbidden by default.
-     */
-    SternBrocot & operator= ( const SternBrocot & other );
+    /// Protects nbFractions.
+    std::mutex myMutex;
 
     // ------------------------- Internals ------------------------------------
   private:
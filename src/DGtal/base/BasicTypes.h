@@ -79,8 +79,61 @@ namespace DGtal
   typedef mpz_class BigInteger;
 #endif
 
+#ifdef BOOST_HAS_INT128
+  #define WITH_INT128
+  ///signed 128-bit integer (compiler extension).
+  typedef boost::int128_type int128_t;
+  ///unsigned 128-bit integer (compiler extension).
+  typedef boost::uint128_type uint128_t;
+#endif
+
 } // namespace DGtal
 
+#ifdef WITH_INT128
+// The output operators of 128-bit integers are global, to be found
+// from any namespace (there is no argument-dependent lookup for
+// fundamental types), and also declared in namespace DGtal, whose
+// own operators hide the global ones.
+/**
+ * Writes an unsigned 128-bit integer in base 10 (the standard
+ * streams have no output operator for 128-bit integers).
+ * @param out the output stream where the integer is written.
+ * @param aValue any unsigned 128-bit integer.
+ * @return the output stream after the writing.
+ */
+inline
+std::ostream & operator<<( std::ostream & out, const DGtal::uint128_t & aValue )
+{
+  char digits[ 40 ];
+  char* p = digits + sizeof( digits );
+  *--p = '\0';
+  DGtal::uint128_t v = aValue;
+  do { *--p = static_cast<char>( '0' + static_cast<int>( v % 10 ) ); v /= 10; }
+  while ( v != 0 );
+  return out << p;
+}
+
+/**
+ * Writes a signed 128-bit integer in base 10.
+ * @param out the output stream where the integer is written.
+ * @param aValue any signed 128-bit integer.
+ * @return the output stream after the writing.
+ */
+inline
+std::ostream & operator<<( std::ostream & out, const DGtal::int128_t & aValue )
+{
+  if ( aValue >= 0 ) return out << static_cast<DGtal::uint128_t>( aValue );
+  // negates in unsigned arithmetic, which is also valid for the minimum.
+  out << '-';
+  return out << ( ~static_cast<DGtal::uint128_t>( aValue ) + 1 );
+}
+
+namespace DGtal
+{
+  using ::operator<<;
+} // namespace DGtal
+#endif
+
 
 
 //                                                                           //
@@ -174,8 +174,12 @@ namespace DGtal
 #ifdef TRACE_BITS
       std::cerr << "unsigned int nbSetBits( DGtal::uint32_t val )" << std::endl;
 #endif
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<unsigned int>( __builtin_popcount( val ) );
+#else
       return nbSetBits( static_cast<DGtal::uint16_t>( val & 0xffff ) ) 
 	+ nbSetBits( static_cast<DGtal::uint16_t>( val >> 16 ) );
+#endif
     }
 
     /**
@@ -188,8 +192,12 @@ namespace DGtal
 #ifdef TRACE_BITS
       std::cerr << "unsigned int nbSetBits( DGtal::uint64_t val )" << std::endl;
 #endif
+#if defined(__GNUC__) || defined(__clang__)
+      return static_cast<unsigned int>( __builtin_popcountll( val ) );
+#else
       return nbSetBits( static_cast<DGtal::uint32_t>( val & 0xffffffffLL ) ) 
 	+ nbSetBits( static_cast<DGtal::uint32_t>( val >> 32 ) );
+#endif
     }
 
     /**
@@ -0,0 +1,290 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedRanges.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedRanges.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedRanges_RECURSES)
+#error Recursive header files inclusion detected in PackedRanges.h
+#else // defined(PackedRanges_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedRanges_RECURSES
+
+#if !defined PackedRanges_h
+/** Prevents repeated inclusion of headers. */
+#define PackedRanges_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedRanges
+  /**
+     Description of template class 'PackedRanges' <p> \brief Aim: An
+     immutable sequence of ranges of values stored in compressed
+     sparse row (CSR) layout, i.e. one array of all the values and one
+     array of offsets, the i-th range being made of the values of
+     indices [offsets[i],offsets[i+1]).
+
+     It replaces a `std::vector< std::vector< Value > >` when the
+     ranges are built once and read many times (e.g. the incidence
+     relations of a mesh): the values of consecutive ranges are
+     contiguous in memory, and there is one allocation instead of one
+     per range. Each range is seen through a PackedRanges::Range, a
+     read-only view offering the usual services of a vector
+     (iterators, size, operator[], conversion to std::vector).
+
+     @code
+     std::vector< std::vector< int > > vv = { { 3, 1 }, {}, { 2, 5, 4 } };
+     PackedRanges< int > ranges( vv.begin(), vv.end() );
+     ranges.size();    // 3
+     ranges[ 2 ][ 1 ]; // 5
+     for ( auto r : ranges )
+       for ( auto x : r ) std::cout << x;
+     @endcode
+
+     @tparam TValue the type of the values.
+
+     @see SurfaceMesh
+   */
+  template <typename TValue>
+  class PackedRanges
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TValue Value;
+    typedef PackedRanges<TValue> Self;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    typedef std::vector<Value> Values;
+    typedef std::vector<Index> Offsets;
+
+    /// A read-only view on a contiguous range of values.
+    class Range
+    {
+    public:
+      typedef TValue value_type;
+      typedef std::size_t size_type;
+      typedef const TValue & reference;
+      typedef const TValue & const_reference;
+      typedef const TValue * iterator;
+      typedef const TValue * const_iterator;
+
+      /// Default constructor. The range is empty.
+      Range() : myBegin( nullptr ), myEnd( nullptr ) {}
+      /// Constructor from two pointers.
+      /// @param b pointer on the first value.
+      /// @param e pointer after the last value.
+      Range( const TValue * b, const TValue * e ) : myBegin( b ), myEnd( e ) {}
+
+      /// @return an iterator on the first value.
+      const_iterator begin() const { return myBegin; }
+      /// @return an iterator after the last value.
+      const_iterator end() const { return myEnd; }
+      /// @return an iterator on the first value.
+      const_iterator cbegin() const { return myBegin; }
+      /// @return an iterator after the last value.
+      const_iterator cend() const { return myEnd; }
+      /// @return the number of values.
+      size_type size() const { return myEnd - myBegin; }
+      /// @return 'true' if the range has no value.
+      bool empty() const { return myBegin == myEnd; }
+      /// @param i an index smaller than size().
+      /// @return the i-th value.
+      const_reference operator[]( size_type i ) const { return myBegin[ i ]; }
+      /// @return the first value (the range is not empty).
+      const_reference front() const { return *myBegin; }
+      /// @return the last value (the range is not empty).
+      const_reference back() const { return *( myEnd - 1 ); }
+      /// @return a copy of the values.
+      operator std::vector<TValue>() const
+      { return std::vector<TValue>( myBegin, myEnd ); }
+      /// @param other another range.
+      /// @return 'true' if both ranges have the same values.
+      bool operator==( const Range & other ) const;
+      /// @param other another range.
+      /// @return 'true' if the ranges have different values.
+      bool operator!=( const Range & other ) const
+      { return ! ( *this == other ); }
+
+    private:
+      const TValue * myBegin;
+      const TValue * myEnd;
+    };
+
+    /// The iterator on the ranges (random-access, its reference is a Range).
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Range const,
+                                       boost::random_access_traversal_tag,
+                                       Range >
+    {
+      friend class PackedRanges<TValue>;
+      friend class boost::iterator_core_access;
+    public:
+      /// Default constructor.
+      ConstIterator() : myRanges( nullptr ), myIndex( 0 ) {}
+    private:
+      ConstIterator( const Self * ranges, Index i ) : myRanges( ranges ), myIndex( i ) {}
+      Range dereference() const { return ( *myRanges )[ myIndex ]; }
+      bool equal( const ConstIterator & other ) const { return myIndex == other.myIndex; }
+      void increment() { ++myIndex; }
+      void decrement() { --myIndex; }
+      void advance( std::ptrdiff_t n ) { myIndex += n; }
+      std::ptrdiff_t distance_to( const ConstIterator & other ) const
+      { return static_cast<std::ptrdiff_t>( other.myIndex ) - static_cast<std::ptrdiff_t>( myIndex ); }
+      const Self * myRanges;
+      Index myIndex;
+    };
+    typedef ConstIterator const_iterator;
+    typedef ConstIterator iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. There is no range.
+    */
+    PackedRanges();
+
+    /**
+       Constructor from a range of ranges of values.
+
+       @tparam RangeIterator a forward iterator on ranges with begin()
+       and end() methods (e.g. std::vector< Value >).
+       @param itb an iterator on the first range.
+       @param ite an iterator after the last range.
+    */
+    template <typename RangeIterator>
+    PackedRanges( RangeIterator itb, RangeIterator ite );
+
+    /**
+       Constructor from CSR arrays, which are moved into the object.
+
+       @param offsets the offsets of the ranges (one more than the
+       number of ranges, increasing, the first one is 0 and the last
+       one is the number of values).
+       @param values the values of all the ranges.
+    */
+    PackedRanges( Offsets && offsets, Values && values );
+
+    /// Clears the object. There is no range.
+    void clear();
+
+    /**
+       Replaces the ranges by the given CSR arrays, which are moved
+       into the object.
+
+       @param offsets the offsets of the ranges (one more than the
+       number of ranges, increasing, the first one is 0 and the last
+       one is the number of values).
+       @param values the values of all the ranges.
+    */
+    void assign( Offsets && offsets, Values && values );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the number of ranges.
+    Size size() const;
+
+    /// @return 'true' if there is no range.
+    bool empty() const;
+
+    /// @return the number of values of all the ranges.
+    Size nbValues() const;
+
+    /**
+       @param i the index of a range.
+       @return this range.
+    */
+    Range operator[]( Index i ) const;
+
+    /// @return an iterator on the first range.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last range.
+    ConstIterator end() const;
+
+    /// @return the offsets of the ranges (one more than the number of ranges).
+    const Offsets & offsets() const;
+
+    /// @return the values of all the ranges.
+    const Values & values() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Writes/Displays the object on an output stream.
+       @param out the output stream where the object is written.
+    */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+       Checks the validity/consistency of the object.
+       @return 'true' if the object is valid, 'false' otherwise.
+    */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The offsets of the ranges.
+    Offsets myOffsets;
+    /// The values of all the ranges.
+    Values myValues;
+
+  }; // end of class PackedRanges
+
+  /**
+     Overloads 'operator<<' for displaying objects of class 'PackedRanges'.
+     @param out the output stream where the object is written.
+     @param object the object of class 'PackedRanges' to write.
+     @return the output stream after the writing.
+  */
+  template <typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedRanges<TValue> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/PackedRanges.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedRanges_h
+
+#undef PackedRanges_RECURSES
+#endif // else defined(PackedRanges_RECURSES)
@@ -43,6 +43,8 @@
 #include <iostream>
 #include <sstream>
 #include <tuple>
+#include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/math/linalg/EigenSupport.h"
@@ -138,6 +140,70 @@ namespace DGtal
     typedef EigenLinearAlgebraBackend::SolverSimplicialLDLT LinearAlgebraSolver;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 2, PRIMAL, 2, PRIMAL> SolverU2;
     typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, PRIMAL, 0, PRIMAL> SolverV0;
+    // u and v change little between iterations, hence an iterative
+    // solver started from their former values is faster than a
+    // factorization.
+    typedef Eigen::ConjugateGradient< typename Calculus::SparseMatrix,
+                                      Eigen::Lower|Eigen::Upper > IterativeSolver;
+
+    /// Linear algebra solver that keeps its symbolic factorization
+    /// as long as the sparsity pattern of the factorized matrices does
+    /// not change, which is the case along AT iterations. Copies
+    /// start without factorization.
+    struct PatternReusingSolver
+    {
+      typedef typename Calculus::SparseMatrix      SparseMatrix;
+      typedef typename SparseMatrix::StorageIndex  StorageIndex;
+
+      PatternReusingSolver() : analyzed( false ), nb_analyses( 0 ) {}
+      PatternReusingSolver( const PatternReusingSolver& )
+        : analyzed( false ), nb_analyses( 0 ) {}
+      PatternReusingSolver& operator=( const PatternReusingSolver& )
+      {
+        analyzed = false;
+        nb_analyses = 0;
+        outer.clear();
+        inner.clear();
+        return *this;
+      }
+
+      /// Factorizes a matrix, analyzing its sparsity pattern only if
+      /// it differs from the one of the previous call.
+      /// @param A any compressed sparse matrix.
+      /// @return 'true' if the factorization succeeded.
+      bool compute( const SparseMatrix& A )
+      {
+        ASSERT( A.isCompressed() );
+        const StorageIndex* A_outer = A.outerIndexPtr();
+        const StorageIndex* A_inner = A.innerIndexPtr();
+        const bool same_pattern = analyzed
+          && outer.size() == size_t( A.outerSize() + 1 )
+          && inner.size() == size_t( A.nonZeros() )
+          && std::equal( outer.begin(), outer.end(), A_outer )
+          && std::equal( inner.begin(), inner.end(), A_inner );
+        if ( ! same_pattern )
+          {
+            solver.analyzePattern( A );
+            outer.assign( A_outer, A_outer + A.outerSize() + 1 );
+            inner.assign( A_inner, A_inner + A.nonZeros() );
+            analyzed = true;
+            ++nb_analyses;
+          }
+        solver.factorize( A );
+        return solver.info() == Eigen::Success;
+      }
+
+      /// The factorized solver.
+      LinearAlgebraSolver       solver;
+      /// Tells if the pattern has been analyzed.
+      bool                      analyzed;
+      /// The number of pattern analyses done so far.
+      std::size_t               nb_analyses;
+      /// The outer indices of the analyzed pattern.
+      std::vector<StorageIndex> outer;
+      /// The inner indices of the analyzed pattern.
+      std::vector<StorageIndex> inner;
+    };
 
   protected:
     /// A smart (or not) pointer to a calculus object.
@@ -169,6 +235,12 @@ namespace DGtal
     PrimalForm0           former_v0;
     /// The primal 0-form lambda/(4epsilon) (stored for performance)
     PrimalForm0           l_1_over_4e;
+    /// The factorization of the u-system, used when the iterative
+    /// solver fails or is disabled.
+    PatternReusingSolver  solver_u2;
+    /// The factorization of the v-system, used when the iterative
+    /// solver fails or is disabled.
+    PatternReusingSolver  solver_v0;
 
   public:
     // The map Surfel -> Index that gives the index of the surfel in 2-forms.
@@ -189,6 +261,10 @@ namespace DGtal
     bool                  normalize_u2;
     /// Tells the verbose level.
     int                   verbose;
+    /// The relative tolerance of the conjugate gradients solving for
+    /// u and v, started from their former values. When non positive,
+    /// u and v are solved with factorizations.
+    double                iterative_tolerance;
 
     // ----------------------- Standard services ------------------------------
     /// @name Standard services
@@ -205,7 +281,8 @@ namespace DGtal
         M01( *ptrCalculus ), M12( *ptrCalculus ), primal_AD2( *ptrCalculus ),
         alpha_Id2( *ptrCalculus ), l_1_over_4e_Id0( *ptrCalculus ),
         g2(), alpha_g2(), u2(), v0( *ptrCalculus ), former_v0( *ptrCalculus ),
-        l_1_over_4e( *ptrCalculus ), verbose( aVerbose )
+        l_1_over_4e( *ptrCalculus ), verbose( aVerbose ),
+        iterative_tolerance( 1e-8 )
     {
       if ( verbose >= 2 )
 	trace.info() << "[ATSolver::ATSolver] " << *ptrCalculus << std::endl;
@@ -552,17 +629,52 @@ namespace DGtal
       const PrimalIdentity2 ope_u2 = alpha_Id2
         + primal_AD2.transpose() * dec_helper::diagonal( v1_squared ) * primal_AD2;
 
-      if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
-      SolverU2 solver_u2;
-      solver_u2.compute( ope_u2 );
-      for ( Dimension d = 0; d < u2.size(); ++d )
+      // channels are solved in parallel, from the former u
+      const long nb_channels = u2.size();
+      bool solve_u2_ok = false;
+      if ( iterative_tolerance > 0.0 )
         {
-          if ( verbose >= 2 ) trace.info() << "Solving U u[" << d << "] = a g[" << d << "]" << std::endl;
-          u2[ d ] = solver_u2.solve( alpha_g2[ d ] );
-          if ( verbose >= 2 ) trace.info() << "  => " << ( solver_u2.isValid() ? "OK" : "ERROR" )
-                                           << " " << solver_u2.myLinearAlgebraSolver.info() << std::endl;
-          solve_ok = solve_ok && solver_u2.isValid();
+          if ( verbose >= 2 ) trace.info() << "Solving U u[:] = a g[:] from former u for "
+                                           << nb_channels << " channels" << std::endl;
+          std::vector<char> channels_ok( nb_channels, 0 );
+          IterativeSolver iterative_solver_u2;
+          iterative_solver_u2.setTolerance( iterative_tolerance );
+          iterative_solver_u2.compute( ope_u2.myContainer );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+          for ( long d = 0; d < nb_channels; ++d )
+            {
+              // solveWithGuess would update the status of the shared
+              // solver, hence channels call the conjugate gradient
+              // loop with its (const) preconditioner directly.
+              typename Calculus::DenseVector u = u2[ d ].myContainer;
+              Eigen::Index iterations = iterative_solver_u2.maxIterations();
+              double error = iterative_tolerance;
+              Eigen::internal::conjugate_gradient( ope_u2.myContainer, alpha_g2[ d ].myContainer, u,
+                                                   iterative_solver_u2.preconditioner(),
+                                                   iterations, error );
+              channels_ok[ d ] = error <= iterative_tolerance;
+              if ( channels_ok[ d ] ) u2[ d ].myContainer = u;
+            }
+          solve_u2_ok = std::find( channels_ok.begin(), channels_ok.end(), 0 ) == channels_ok.end();
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solve_u2_ok ? "OK" : "ERROR" ) << std::endl;
+        }
+      if ( ! solve_u2_ok )
+        {
+          if ( verbose >= 2 ) trace.info() << "Prefactoring matrix U associated to u" << std::endl;
+          solve_u2_ok = solver_u2.compute( ope_u2.myContainer );
+          if ( verbose >= 2 ) trace.info() << "Solving U u[:] = a g[:] for "
+                                           << nb_channels << " channels" << std::endl;
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+          for ( long d = 0; d < nb_channels; ++d )
+            u2[ d ].myContainer = solver_u2.solver.solve( alpha_g2[ d ].myContainer );
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solve_u2_ok ? "OK" : "ERROR" )
+                                           << " " << solver_u2.solver.info() << std::endl;
         }
+      solve_ok = solve_ok && solve_u2_ok;
       if ( normalize_u2 ) normalizeU2();
       if ( verbose >= 1 ) trace.endBlock();
       if ( verbose >= 1 ) trace.beginBlock("Solving for v");
@@ -570,19 +682,36 @@ namespace DGtal
       PrimalForm1 squared_norm_d_u2 = PrimalForm1::zeros(*ptrCalculus);
       for ( Dimension d = 0; d < u2.size(); ++d )
         squared_norm_d_u2.myContainer.array() += (primal_AD2 * u2[ d ] ).myContainer.array().square();
-      trace.info() << "build metric u2" << std::endl;
+      if ( verbose >= 2 ) trace.info() << "build metric u2" << std::endl;
       const PrimalIdentity0 ope_v0 = l_1_over_4e_Id0
         + (lambda * epsilon) * primal_D0.transpose() * primal_D0
 	+ M01.transpose() * dec_helper::diagonal( squared_norm_d_u2 ) * M01;
 
-      if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
-      SolverV0 solver_v0;
-      solver_v0.compute( ope_v0 );
-      if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
-      v0 = solver_v0.solve( l_1_over_4e );
-      if ( verbose >= 2 ) trace.info() << "  => " << ( solver_v0.isValid() ? "OK" : "ERROR" )
-                                       << " " << solver_v0.myLinearAlgebraSolver.info() << std::endl;
-      solve_ok = solve_ok && solver_v0.isValid();
+      bool solve_v0_ok = false;
+      if ( iterative_tolerance > 0.0 )
+        {
+          if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1 from former v" << std::endl;
+          IterativeSolver iterative_solver_v0;
+          iterative_solver_v0.setTolerance( iterative_tolerance );
+          iterative_solver_v0.compute( ope_v0.myContainer );
+          const auto v = iterative_solver_v0.solveWithGuess( l_1_over_4e.myContainer,
+                                                             former_v0.myContainer );
+          solve_v0_ok = iterative_solver_v0.info() == Eigen::Success;
+          if ( solve_v0_ok ) v0.myContainer = v;
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solve_v0_ok ? "OK" : "ERROR" )
+                                           << " in " << iterative_solver_v0.iterations()
+                                           << " iterations" << std::endl;
+        }
+      if ( ! solve_v0_ok )
+        {
+          if ( verbose >= 2 ) trace.info() << "Prefactoring matrix V associated to v" << std::endl;
+          solve_v0_ok = solver_v0.compute( ope_v0.myContainer );
+          if ( verbose >= 2 ) trace.info() << "Solving V v = l/4e * 1" << std::endl;
+          v0.myContainer = solver_v0.solver.solve( l_1_over_4e.myContainer );
+          if ( verbose >= 2 ) trace.info() << "  => " << ( solve_v0_ok ? "OK" : "ERROR" )
+                                           << " " << solver_v0.solver.info() << std::endl;
+        }
+      solve_ok = solve_ok && solve_v0_ok;
       if ( verbose >= 1 ) trace.endBlock();
       return solve_ok;
     }
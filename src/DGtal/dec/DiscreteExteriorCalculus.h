@@ -69,6 +69,10 @@ namespace DGtal
   template <typename TLinearAlgebraBackend, typename TInteger>
   class DiscreteExteriorCalculusFactory;
 
+  // forward matrix-free operator declaration
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator;
+
   /**
    * Hash function for Khalimsky unsigned cells.
    * @param cell input signed cell.
@@ -395,6 +399,9 @@ namespace DGtal
 
     /**
      * Laplace operator from duality 0-forms to duality 0-forms.
+     * The sparsity pattern of the operator is computed once after each
+     * call to updateIndexes(), subsequent calls only recompute its
+     * coefficients from the current cell sizes.
      * @return Laplace operator.
      */
     template <Duality duality>
@@ -422,6 +429,41 @@ namespace DGtal
     LinearOperator<Self, order, duality, dimEmbedded-order, OppositeDuality<duality>::duality>
     hodge() const;
 
+    /**
+     * Matrix-free derivative operator from _order_-forms to _(order+1)_-forms.
+     * Applies derivative() by a stencil over the incident cells, without assembling its matrix.
+     * Requires DGtal/dec/MatrixFreeLinearOperator.h.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return matrix-free derivative operator.
+     */
+    template <Order order, Duality duality>
+    MatrixFreeLinearOperator<Self, order, duality, order+1, duality>
+    matrixFreeDerivative() const;
+
+    /**
+     * Matrix-free hodge operator from duality _order_-form to opposite duality _(dimEmbedded-order)_-forms.
+     * Only the diagonal of hodge() is stored, computed from the current cell sizes.
+     * Requires DGtal/dec/MatrixFreeLinearOperator.h.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return matrix-free hodge operator.
+     */
+    template <Order order, Duality duality>
+    MatrixFreeLinearOperator<Self, order, duality, dimEmbedded-order, OppositeDuality<duality>::duality>
+    matrixFreeHodge() const;
+
+    /**
+     * Matrix-free laplace operator from duality 0-forms to duality 0-forms.
+     * Same operator as laplace(), applied as a product of matrix-free derivatives and hodges,
+     * hence its memory footprint is linear in the number of cells.
+     * Requires DGtal/dec/MatrixFreeLinearOperator.h.
+     * @return matrix-free laplace operator.
+     */
+    template <Duality duality>
+    MatrixFreeLinearOperator<Self, 0, duality, 0, duality>
+    matrixFreeLaplace() const;
+
     /**
      * Construct 1-form from vector field.
      * @tparam duality input vector field and output 1-form duality.
@@ -490,6 +532,7 @@ namespace DGtal
 
     /**
      * Get k-form index from cell.
+     * Binary search in the sorted cells of the same dimension.
      * @param cell Khalimsky cell.
      * @return associated k-form index.
      */
@@ -558,6 +601,40 @@ namespace DGtal
      */
     IndexedSCells myIndexSignedCells;
 
+    /**
+     * Cells of each dimension with their index, sorted by cell.
+     * Used for index lookups during operator assembly.
+     */
+    typedef std::pair<Cell, Index> IndexedCell;
+    boost::array<std::vector<IndexedCell>, dimEmbedded+1> myIndexCells;
+
+    /**
+     * @struct LaplaceStructure
+     * @brief Sparsity pattern of the laplace operator L = s H2 A H1 D,
+     * where D and A are derivatives and H1 and H2 diagonal hodges.
+     * For the k-th stored coefficient of 'pattern', whose row is 'rows[k]',
+     * the products A(row,e)*D(e,col) are listed in 'edges' and 'values'
+     * between 'begins[k]' and 'begins[k+1]'.
+     */
+    struct LaplaceStructure
+    {
+        SparseMatrix pattern;
+        std::vector<Index> rows;
+        std::vector<Index> begins;
+        std::vector<Index> edges;
+        std::vector<Scalar> values;
+    };
+
+    /**
+     * Laplace operator sparsity patterns for primal and dual duality.
+     */
+    boost::array<LaplaceStructure, 2> myLaplaceStructures;
+
+    /**
+     * Laplace operator sparsity patterns need to be computed.
+     */
+    boost::array<bool, 2> myLaplaceStructuresNeedUpdate;
+
     /**
      * Cached flat operator matrix.
      */
@@ -607,6 +684,51 @@ namespace DGtal
     void
     updateSharpOperator();
 
+    /**
+     * Compute laplace operator sparsity pattern for duality.
+     * @tparam duality duality of laplace operator.
+     */
+    template <Duality duality>
+    void
+    updateLaplaceStructure();
+
+    /**
+     * Diagonal coefficients of the hodge operator.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return vector of size kFormLength(order, duality).
+     */
+    template <Order order, Duality duality>
+    DenseVector
+    hodgeDiagonal() const;
+
+    /**
+     * Apply derivative operator stencil.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @param input input kform container.
+     * @param output output kform container, resized to kFormLength(order+1, duality).
+     */
+    template <Order order, Duality duality>
+    void
+    applyDerivative(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Find the index of a cell in the sorted cells of its dimension.
+     * @param cell Khalimsky cell.
+     * @return cell index, std::numeric_limits<Index>::max() if cell is not in the structure.
+     */
+    Index
+    findCellIndex(const Cell& cell) const;
+
+    /**
+     * Number of blocks of indexes processed in parallel by operator assembly.
+     * @param length number of indexes.
+     * @return the number of blocks, in 1..max(1,length).
+     */
+    static long
+    nbIndexBlocks(const Index& length);
+
   }; // end of class DiscreteExteriorCalculus
 
 
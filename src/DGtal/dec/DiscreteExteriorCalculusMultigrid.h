@@ -0,0 +1,370 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DiscreteExteriorCalculusMultigrid.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DiscreteExteriorCalculusMultigrid.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DiscreteExteriorCalculusMultigrid_RECURSES)
+#error Recursive header files inclusion detected in DiscreteExteriorCalculusMultigrid.h
+#else // defined(DiscreteExteriorCalculusMultigrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DiscreteExteriorCalculusMultigrid_RECURSES
+
+#if !defined DiscreteExteriorCalculusMultigrid_h
+/** Prevents repeated inclusion of headers. */
+#define DiscreteExteriorCalculusMultigrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <memory>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+#include "DGtal/dec/LinearOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DiscreteExteriorCalculusMultigrid
+  /**
+   * Description of template class 'DiscreteExteriorCalculusMultigrid' <p>
+   * \brief Aim:
+   * Geometric multigrid for linear problems between _order_-forms of a discrete exterior calculus
+   * built on a regular grid, for instance with DiscreteExteriorCalculusFactory::createFromDigitalSet.
+   *
+   * The Khalimsky space of the calculus is coarsened by a factor 2 in each direction, until the number
+   * of kform values is small enough. Kforms of coarse levels live on the coarse cells covering the
+   * cells of the finer level. The prolongation of a coarse kform is the tensor product, along each
+   * direction, of the linear interpolation of lowest order Whitney forms: values of coarse cells
+   * are interpolated linearly along the directions orthogonal to the cell and are split in halves along
+   * the directions of the cell. Hence prolongations commute with derivatives. Dual kforms are
+   * transferred as the primal cells they are attached to.
+   * Restrictions are transposed prolongations and coarse operators are Galerkin products,
+   * recomputed by each call to compute().
+   *
+   * Each application of the multigrid performs V-cycles, with forward Gauss-Seidel pre-smoothing,
+   * backward Gauss-Seidel post-smoothing and a sparse LU factorization of the coarsest operator.
+   * V-cycles are symmetric when the operator is.
+   *
+   * The multigrid follows the interface of Eigen preconditioners. It is usually used as the
+   * preconditioner of the conjugate gradient or BiCGSTAB solvers, and can be wrapped inside
+   * DiscreteExteriorCalculusSolver:
+   * @code
+   * typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, PRIMAL> Multigrid;
+   * typedef DiscreteExteriorCalculusSolver<Calculus, Multigrid::SolverConjugateGradient, 0, PRIMAL, 0, PRIMAL> Solver;
+   * Solver solver;
+   * solver.myLinearAlgebraSolver.preconditioner().init(calculus);
+   * solver.compute(laplace);
+   * const Calculus::PrimalForm0 solution = solver.solve(input);
+   * @endcode
+   * With setNbCycles(), it can also be used as a stand-alone solver.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus, with equal embedded and ambient dimensions and EigenLinearAlgebraBackend.
+   * @tparam order order of the kforms of the linear problem.
+   * @tparam duality duality of the kforms of the linear problem.
+   */
+  template <typename TCalculus, Order order, Duality duality>
+  class DiscreteExteriorCalculusMultigrid
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef DiscreteExteriorCalculusMultigrid<Calculus, order, duality> Self;
+
+    BOOST_STATIC_ASSERT(( order >= 0 ));
+    BOOST_STATIC_ASSERT(( order <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( Calculus::dimensionEmbedded == Calculus::dimensionAmbient ));
+
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::Cell Cell;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+    typedef typename SparseMatrix::StorageIndex StorageIndex;
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, StorageIndex> RowMajorSparseMatrix;
+    typedef KForm<Calculus, order, duality> SolutionKForm;
+    typedef LinearOperator<Calculus, order, duality, order, duality> Operator;
+
+    ///Eigen iterative solvers preconditioned by the multigrid
+    typedef Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower|Eigen::Upper, Self> SolverConjugateGradient;
+    typedef Eigen::BiCGSTAB<SparseMatrix, Self> SolverBiCGSTAB;
+
+    /**
+     * Default constructor. init() must be called before compute().
+     */
+    DiscreteExteriorCalculusMultigrid();
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    DiscreteExteriorCalculusMultigrid(ConstAlias<Calculus> calculus);
+
+    /**
+     * Computes the coarse levels and the prolongations between them.
+     * The calculus should not be modified afterwards.
+     * @param calculus the discrete exterior calculus to use.
+     */
+    void init(ConstAlias<Calculus> calculus);
+
+    /**
+     * Sets the number of kform values under which a level is the coarsest one.
+     * Takes effect at the next call to init().
+     * @param size maximal number of kform values of the coarsest level (default 512).
+     */
+    void setCoarsestSize(const Index& size);
+
+    /**
+     * Sets the maximal number of levels, including the finest one.
+     * Takes effect at the next call to init().
+     * @param nb_levels maximal number of levels (default 32).
+     */
+    void setMaxNbLevels(const std::size_t& nb_levels);
+
+    /**
+     * Sets the number of pre-smoothing and post-smoothing Gauss-Seidel sweeps on each level.
+     * @param nb_steps number of sweeps (default 2).
+     */
+    void setNbSmoothingSteps(const int& nb_steps);
+
+    /**
+     * Sets the number of V-cycles performed by solve(), starting from a zero solution.
+     * @param nb_cycles number of V-cycles (default 1, i.e. preconditioner).
+     */
+    void setNbCycles(const int& nb_cycles);
+
+    /**
+     * Computes the Galerkin operators of coarse levels and factorizes the coarsest one.
+     * @param matrix the operator matrix between _order_-forms, of size kFormLength(order, duality).
+     * @return reference to this.
+     */
+    template <typename MatrixType>
+    Self& compute(const MatrixType& matrix);
+
+    /**
+     * Computes the Galerkin operators of coarse levels and factorizes the coarsest one.
+     * @param linear_operator the operator between _order_-forms.
+     * @return reference to this.
+     */
+    Self& compute(const Operator& linear_operator);
+
+    /**
+     * Does nothing, as required by Eigen preconditioners.
+     * @return reference to this.
+     */
+    template <typename MatrixType>
+    Self& analyzePattern(const MatrixType& matrix);
+
+    /**
+     * Same as compute(), as required by Eigen preconditioners.
+     * @param matrix the operator matrix.
+     * @return reference to this.
+     */
+    template <typename MatrixType>
+    Self& factorize(const MatrixType& matrix);
+
+    /**
+     * Applies V-cycles to a kform container, starting from zero.
+     * @param input right hand side kform container.
+     * @return approximate solution container.
+     */
+    template <typename Rhs>
+    DenseVector solve(const Eigen::MatrixBase<Rhs>& input) const;
+
+    /**
+     * Applies V-cycles to a kform, starting from zero.
+     * @param input right hand side kform.
+     * @return approximate solution kform.
+     */
+    SolutionKForm solve(const SolutionKForm& input) const;
+
+    /**
+     * @return Eigen::Success after a successful compute(), Eigen::InvalidInput otherwise.
+     */
+    Eigen::ComputationInfo info() const;
+
+    /**
+     * @return number of levels, including the finest one.
+     */
+    std::size_t nbLevels() const;
+
+    /**
+     * @param level level index, 0 being the finest one.
+     * @return number of kform values of the level.
+     */
+    Index levelSize(const std::size_t& level) const;
+
+    /**
+     * @param level level index, 0 being the finest one.
+     * @return Khalimsky space of the level.
+     */
+    const KSpace& levelSpace(const std::size_t& level) const;
+
+    /**
+     * @param level level index, smaller than nbLevels()-1.
+     * @return prolongation matrix from level+1 kforms to level kforms.
+     */
+    const SparseMatrix& prolongation(const std::size_t& level) const;
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * @struct Level
+     * @brief Cells, transfer and operator of one level of the multigrid.
+     */
+    struct Level
+    {
+        KSpace space; ///< Khalimsky space of the level.
+        std::vector<typename KSpace::Point> kcoords; ///< Khalimsky coordinates of the cells of the kform values.
+        std::vector<Scalar> signs; ///< Orientation of the cells of the kform values.
+        SparseMatrix prolongation; ///< Prolongation from the next coarser level, empty on the coarsest level.
+        RowMajorSparseMatrix matrix; ///< Operator of the level.
+        DenseVector inverse_diagonal; ///< Inverse of the operator diagonal, zero where the diagonal vanishes.
+    };
+
+    /**
+     * Levels, from finest to coarsest.
+     */
+    std::vector<Level> myLevels;
+
+    /**
+     * Factorization of the coarsest operator, shared by copies, null when it failed.
+     */
+    std::shared_ptr< const Eigen::SparseLU<SparseMatrix> > myCoarsestSolver;
+
+    /**
+     * Maximal size of the coarsest level.
+     */
+    Index myCoarsestSize;
+
+    /**
+     * Maximal number of levels.
+     */
+    std::size_t myMaxNbLevels;
+
+    /**
+     * Number of pre-smoothing and post-smoothing sweeps.
+     */
+    int myNbSmoothingSteps;
+
+    /**
+     * Number of V-cycles per solve.
+     */
+    int myNbCycles;
+
+    /**
+     * Status of last compute.
+     */
+    Eigen::ComputationInfo myInfo;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Builds the next coarser level and its prolongation.
+     * @param fine fine level, whose prolongation is set.
+     * @param coarse coarse level to fill.
+     */
+    static void coarsen(Level& fine, Level& coarse);
+
+    /**
+     * Gauss-Seidel sweep.
+     * @param level level index.
+     * @param input right hand side.
+     * @param solution current solution, updated.
+     * @param forward sweep order.
+     */
+    void smooth(const std::size_t& level, const DenseVector& input, DenseVector& solution, const bool forward) const;
+
+    /**
+     * V-cycle.
+     * @param level level index.
+     * @param input right hand side.
+     * @param solution current solution, updated.
+     */
+    void cycle(const std::size_t& level, const DenseVector& input, DenseVector& solution) const;
+
+    /**
+     * Number of blocks of indexes processed in parallel.
+     * @param length number of indexes.
+     * @return the number of blocks, in 1..max(1,length).
+     */
+    static long nbIndexBlocks(const Index& length);
+
+  }; // end of class DiscreteExteriorCalculusMultigrid
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DiscreteExteriorCalculusMultigrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DiscreteExteriorCalculusMultigrid' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Calculus, Order order, Duality duality>
+  std::ostream&
+  operator<<(std::ostream& out, const DiscreteExteriorCalculusMultigrid<Calculus, order, duality>& object);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/DiscreteExteriorCalculusMultigrid.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DiscreteExteriorCalculusMultigrid_h
+
+#undef DiscreteExteriorCalculusMultigrid_RECURSES
+#endif // else defined(DiscreteExteriorCalculusMultigrid_RECURSES)
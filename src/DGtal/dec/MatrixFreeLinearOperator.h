@@ -0,0 +1,333 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLinearOperator.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module MatrixFreeLinearOperator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLinearOperator_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLinearOperator.h
+#else // defined(MatrixFreeLinearOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLinearOperator_RECURSES
+
+#if !defined MatrixFreeLinearOperator_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLinearOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <functional>
+#include <memory>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+#include "DGtal/dec/LinearOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator;
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// Matrix-free operators have the traits of the sparse matrices of their calculus.
+    template <typename TCalculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out>
+    struct traits< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
+      : public traits< typename TCalculus::SparseMatrix >
+    {};
+  } // namespace internal
+} // namespace Eigen
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLinearOperator
+  /**
+   * Description of template class 'MatrixFreeLinearOperator' <p>
+   * \brief Aim:
+   * MatrixFreeLinearOperator represents discrete linear operator between discrete kforms in the DEC package,
+   * without storing its matrix.
+   *
+   * The operator is given by a kernel that computes its application to a kform container.
+   * DiscreteExteriorCalculus::matrixFreeDerivative computes derivatives by a stencil over the
+   * Khalimsky cells, and DiscreteExteriorCalculus::matrixFreeHodge stores only hodge diagonals.
+   * Products, sums and scalings of matrix-free operators are evaluated lazily on kforms,
+   * hence DiscreteExteriorCalculus::matrixFreeLaplace uses O(cells) memory instead of O(nonzeros).
+   *
+   * Matrix-free operators can be given directly to Eigen iterative solvers, for instance
+   * MatrixFreeLinearOperator::SolverConjugateGradient and MatrixFreeLinearOperator::SolverBiCGSTAB,
+   * which are EigenLinearAlgebraBackend::SolverConjugateGradient and EigenLinearAlgebraBackend::SolverBiCGSTAB
+   * without preconditioner.
+   *
+   * @code
+   * typedef Calculus::MatrixFreePrimalIdentity0 Laplace;
+   * const Laplace laplace = calculus.matrixFreeLaplace<PRIMAL>();
+   * Laplace::SolverBiCGSTAB solver;
+   * solver.compute(laplace);
+   * const Calculus::PrimalForm0 x(calculus, solver.solve(b.myContainer));
+   * @endcode
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   * @tparam order_in is the input order of the linear operator.
+   * @tparam duality_in is the input duality of the linear operator.
+   * @tparam order_out is the output order of the linear operator.
+   * @tparam duality_out is the output duality of the linear operator.
+   */
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator
+    : public Eigen::EigenBase< MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Self;
+
+    BOOST_STATIC_ASSERT(( order_in >= 0 ));
+    BOOST_STATIC_ASSERT(( order_in <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( order_out >= 0 ));
+    BOOST_STATIC_ASSERT(( order_out <= Calculus::dimensionEmbedded ));
+
+    ///Calculus scalar type
+    typedef typename Calculus::Scalar Scalar;
+    ///Calculus index type
+    typedef typename Calculus::Index Index;
+    ///Calculus dense vector type, i.e. kform container type
+    typedef typename Calculus::DenseVector DenseVector;
+    ///Input KForm type
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    ///Output KForm type
+    typedef KForm<Calculus, order_out, duality_out> OutputKForm;
+    ///Linear operator type with the same input and output
+    typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
+    ///Kernel type: computes output container from input container
+    typedef std::function<void(const DenseVector&, DenseVector&)> Kernel;
+
+    ///Types required by Eigen solvers
+    typedef Scalar RealScalar;
+    typedef typename Calculus::SparseMatrix::StorageIndex StorageIndex;
+    enum
+    {
+        ColsAtCompileTime = Eigen::Dynamic,
+        MaxColsAtCompileTime = Eigen::Dynamic,
+        IsRowMajor = false
+    };
+
+    ///Eigen iterative solvers accepting the operator
+    typedef Eigen::ConjugateGradient<Self, Eigen::Lower|Eigen::Upper, Eigen::IdentityPreconditioner> SolverConjugateGradient;
+    typedef Eigen::BiCGSTAB<Self, Eigen::IdentityPreconditioner> SolverBiCGSTAB;
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus to use.
+     * @param kernel computes the output container from the input container, resizing it.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus, const Kernel& kernel);
+
+    /**
+     * Constructor from linear operator, whose matrix is shared by the kernel.
+     * @param linear_operator the linear operator to apply.
+     */
+    explicit MatrixFreeLinearOperator(const Operator& linear_operator);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Kernel applying the operator.
+     */
+    Kernel myKernel;
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * Applies the operator.
+     * @param input input kform container, of size cols().
+     * @param output output kform container, resized to rows().
+     */
+    void apply(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * @return number of output kform values.
+     */
+    Index rows() const;
+
+    /**
+     * @return number of input kform values.
+     */
+    Index cols() const;
+
+    /**
+     * Lazy product with a dense vector, as required by Eigen solvers.
+     * @param vector dense vector of size cols().
+     * @return product expression.
+     */
+    template <typename Rhs>
+    Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<Rhs>& vector) const
+    {
+        return Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>(*this, vector.derived());
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+  }; // end of class MatrixFreeLinearOperator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLinearOperator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLinearOperator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  std::ostream&
+  operator<<(std::ostream& out,
+             const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& object);
+
+  /**
+   * Overloads 'operator+' for adding objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator_a left operant
+   * @param linear_operator_b right operant
+   * @return linear_operator_a + linear_operator_b, evaluated lazily.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator+(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_a,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_b);
+
+  /**
+   * Overloads 'operator-' for substracting objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator_a left operant
+   * @param linear_operator_b right operant
+   * @return linear_operator_a - linear_operator_b, evaluated lazily.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator-(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_a,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator_b);
+
+  /**
+   * Overloads 'operator*' for scalar multiplication of objects of class 'MatrixFreeLinearOperator'.
+   * @param scalar left operant
+   * @param linear_operator right operant
+   * @return scalar * linear_operator, evaluated lazily.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const typename Calculus::Scalar& scalar,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+  /**
+   * Overloads 'operator*' for internal multiplication of objects of class 'MatrixFreeLinearOperator'.
+   * No matrix is computed: the right operator is applied before the left one.
+   * @param operator_left left operant
+   * @param operator_right right operant
+   * @return operator_left * operator_right, evaluated lazily.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_fold, Duality duality_fold, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_fold, duality_fold, order_out, duality_out>& operator_left,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_fold, duality_fold>& operator_right);
+
+  /**
+   * Overloads 'operator*' for application of objects of class 'MatrixFreeLinearOperator' on kforms.
+   * @param linear_operator left operant
+   * @param input_form right operant
+   * @return linear_operator * input_form.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  KForm<Calculus, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator,
+            const KForm<Calculus, order_in, duality_in>& input_form);
+
+  /**
+   * Overloads 'operator-' for unary additive inverse of objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator operant
+   * @return -linear_operator, evaluated lazily.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator-(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// Product of matrix-free operators with dense vectors, used by Eigen solvers.
+    template <typename TCalculus, DGtal::Order order_in, DGtal::Duality duality_in, DGtal::Order order_out, DGtal::Duality duality_out, typename Rhs>
+    struct generic_product_impl< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs, SparseShape, DenseShape, GemvProduct >
+      : generic_product_impl_base< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs,
+                                   generic_product_impl< DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>, Rhs > >
+    {
+      typedef DGtal::MatrixFreeLinearOperator<TCalculus, order_in, duality_in, order_out, duality_out> Lhs;
+      typedef typename Product<Lhs, Rhs>::Scalar Scalar;
+
+      template <typename Dest>
+      static void scaleAndAddTo(Dest& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha)
+      {
+        const typename Lhs::DenseVector input(rhs);
+        typename Lhs::DenseVector output;
+        lhs.apply(input, output);
+        dst.noalias() += alpha * output;
+      }
+    };
+  } // namespace internal
+} // namespace Eigen
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLinearOperator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLinearOperator_h
+
+#undef MatrixFreeLinearOperator_RECURSES
+#endif // else defined(MatrixFreeLinearOperator_RECURSES)
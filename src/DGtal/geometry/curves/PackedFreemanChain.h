@@ -0,0 +1,372 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: Compact storage of a 4-connected Freeman chain code,
+   * with two bits per move instead of one character as in
+   * FreemanChain.
+   *
+   * Codes are the ones of FreemanChain (0: +x, 1: +y, 2: -x, 3: -y),
+   * packed 32 per 64-bit word, the code of index i lying in bits
+   * 2(i%32) and 2(i%32)+1 of word i/32. The chain also stores its
+   * first point.
+   *
+   * Points are decoded in bulk by decode(): the displacements of each
+   * byte (four codes) are read in a precomputed table and the points
+   * are their prefix sums. The number of codes of each kind in a
+   * range, hence the displacement of the range, is computed with
+   * population counts, so that the chain may be cut into blocks
+   * whose first points are known beforehand; blocks are decoded in
+   * parallel when DGtal is built with OpenMP.
+   *
+   * @code
+   * FreemanChain<int> fc( "0001112223", 0, 0 );
+   * PackedFreemanChain<int> pfc( fc );
+   * std::vector< PackedFreemanChain<int>::Point > points;
+   * pfc.decode( points ); // the 11 points of the chain
+   * @endcode
+   *
+   * @tparam TInteger the type of the coordinates, a model of CInteger.
+   *
+   * @see FreemanChain, testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef FreemanChain<Integer> Chain;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    /// Type of the words storing the codes.
+    typedef DGtal::uint64_t Word;
+    /// Type of a code, between 0 and 3.
+    typedef unsigned int Code;
+
+    /// Number of codes per word.
+    static const unsigned int CodesPerWord = 32;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a string of codes.
+     * @param s the chain code (characters '0' to '3').
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s, Integer x, Integer y );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param fc any Freeman chain.
+     */
+    PackedFreemanChain( const Chain & fc );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    PackedFreemanChain( const PackedFreemanChain & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    PackedFreemanChain & operator=( const PackedFreemanChain & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~PackedFreemanChain() = default;
+
+    // ----------------------- Codes --------------------------------------
+  public:
+
+    /// @return the number of codes of the chain.
+    Size size() const;
+
+    /// @return 'true' iff the chain has no code.
+    bool empty() const;
+
+    /**
+     * Removes all the codes, the first point is kept.
+     */
+    void clear();
+
+    /**
+     * Reserves memory for a given number of codes.
+     * @param n a number of codes.
+     */
+    void reserve( Size n );
+
+    /**
+     * @param i an index smaller than size().
+     * @return the code of index @a i.
+     */
+    Code code( Index i ) const;
+
+    /**
+     * Changes the code of index @a i.
+     * @param i an index smaller than size().
+     * @param c a code between 0 and 3.
+     */
+    void setCode( Index i, Code c );
+
+    /**
+     * Appends a code.
+     * @param c a code between 0 and 3.
+     */
+    void push_back( Code c );
+
+    /// @return the first point of the chain.
+    Point firstPoint() const;
+
+    /**
+     * Changes the first point of the chain (the chain is translated).
+     * @param p any point.
+     */
+    void setFirstPoint( const Point & p );
+
+    /**
+     * @return the last point of the chain, in O(size()/32) with
+     * population counts.
+     */
+    Point lastPoint() const;
+
+    /**
+     * @param first an index not greater than @a last.
+     * @param last an index not greater than size().
+     * @return the displacement of the codes of index in [first,last).
+     */
+    Vector displacement( Index first, Index last ) const;
+
+    /// @return the words storing the codes.
+    const std::vector<Word> & words() const;
+
+    /// @return the memory used by the codes, in bytes.
+    Size memory() const;
+
+    /**
+     * @param other any packed chain.
+     * @return 'true' iff both chains have the same first point and
+     * the same codes.
+     */
+    bool operator==( const PackedFreemanChain & other ) const;
+
+    /**
+     * @param other any packed chain.
+     * @return 'true' iff the chains differ.
+     */
+    bool operator!=( const PackedFreemanChain & other ) const;
+
+    // ----------------------- Conversions --------------------------------------
+  public:
+
+    /**
+     * Decodes the points of the chain.
+     *
+     * @param points (returns) the size()+1 points of the chain, from
+     * the first point to the last one, i.e. the points visited by
+     * FreemanChain::ConstIterator.
+     */
+    void decode( std::vector<Point> & points ) const;
+
+    /**
+     * Decodes the points of a part of the chain.
+     *
+     * @param first an index not greater than @a last.
+     * @param last an index not greater than size().
+     * @param out an output iterator on points, receiving the
+     * last-first+1 points between the code @a first and the code @a
+     * last.
+     * @return the output iterator after the last written point.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator decode( Index first, Index last, TOutputIterator out ) const;
+
+    /**
+     * @return the Freeman chain with the same codes and first point.
+     */
+    Chain toFreemanChain() const;
+
+    /**
+     * @return the string of codes (characters '0' to '3').
+     */
+    std::string toString() const;
+
+    /**
+     * Assigns the chain from a string of codes.
+     * @param s the chain code (characters '0' to '3').
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    void assign( const std::string & s, Integer x, Integer y );
+
+    /**
+     * Assigns the chain from a range of 4-connected points.
+     *
+     * @param itb begin iterator on points.
+     * @param ite end iterator on points.
+     * @throw ConnectivityException if two consecutive points are not
+     * 4-adjacent.
+     */
+    template <typename TConstIterator>
+    void assignFromPoints( TConstIterator itb, TConstIterator ite );
+
+    /**
+     * Initializes a grid curve (or any object with a method
+     * initFromPointsVector) from the points of the chain.
+     *
+     * @param gc (returns) the grid curve.
+     * @return the value returned by gc.initFromPointsVector.
+     */
+    template <typename TGridCurve>
+    bool toGridCurve( TGridCurve & gc ) const;
+
+    /**
+     * Assigns the chain from the points of a grid curve (or any object
+     * with a method getPointsRange).
+     *
+     * @param gc any grid curve.
+     */
+    template <typename TGridCurve>
+    void assignFromGridCurve( const TGridCurve & gc );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The first point.
+    Point myFirstPoint;
+    /// Number of codes.
+    Size mySize;
+    /// Packed codes.
+    std::vector<Word> myWords;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Displacements of the four codes stored in a byte.
+    struct ByteTable
+    {
+      ByteTable();
+      /// dx[b][k] (resp. dy) is the x (resp. y) displacement after the k+1 first codes of b.
+      signed char dx[ 256 ][ 4 ];
+      signed char dy[ 256 ][ 4 ];
+    };
+
+    /// @return the (shared) table of byte displacements.
+    static const ByteTable & byteTable();
+
+    /**
+     * @param w a word.
+     * @param c a code.
+     * @return the number of fields of @a w equal to @a c.
+     */
+    static unsigned int countCode( Word w, Code c );
+
+  }; // end of class PackedFreemanChain
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -451,6 +452,27 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the maximal segments of the segmentation, i.e. the
+     * segments visited from begin() to end(), in the same order.
+     *
+     * When ConstIterator is a random-access iterator or circulator,
+     * the part of the range lying between the first and the last
+     * maximal segments is cut into chunks. In each chunk, the
+     * sequence of maximal segments starts with the first maximal
+     * segment passing through the first element of the chunk and
+     * stops at the one starting the next chunk, so that the
+     * concatenation of the chunks is exactly the sequential
+     * segmentation. Chunks are processed in parallel when DGtal is
+     * built with OpenMP.
+     *
+     * @param segments (returns) the maximal segments.
+     * @param nbChunks the number of chunks, 0 means one chunk per
+     * available thread.
+     */
+    void computeMaximalSegments( std::vector<SegmentComputer> & segments,
+                                 unsigned int nbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -520,6 +542,24 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Computes the maximal segments sequentially with a
+     * SegmentComputerIterator.
+     * @param segments (returns) the maximal segments.
+     * @param nbChunks unused.
+     */
+    void computeMaximalSegments( std::vector<SegmentComputer> & segments,
+                                 unsigned int nbChunks, ForwardCategory ) const;
+
+    /**
+     * Computes the maximal segments chunk by chunk, see
+     * computeMaximalSegments.
+     * @param segments (returns) the maximal segments.
+     * @param nbChunks the number of chunks.
+     */
+    void computeMaximalSegments( std::vector<SegmentComputer> & segments,
+                                 unsigned int nbChunks, RandomAccessCategory ) const;
+
   }; // end of class SaturatedSegmentation
 
 
@@ -103,6 +103,10 @@ namespace DGtal {
     /**
      * @tparam OutputIterator writable iterator.
      * More efficient way to compute tangent directions for all points of a curve.
+     * The maximal segments are computed once, and the points are then
+     * swept in order, each one knowing the interval of the segments
+     * containing it. The sweep is cut into chunks of points processed
+     * in parallel when DGtal is built with OpenMP.
      * @param itb begin iterator
      * @param ite end iterator
      * @param result writable iterator over a container which stores estimated tangent directions.
@@ -121,15 +125,26 @@ namespace DGtal {
     // ------------------------- Internals ------------------------------------
   protected:
     
+    /// Index of a point in the evaluated range.
+    typedef std::size_t Index;
+
     /**
-     * @brief Accumulate partial results obtained for each point.
-     * 
-     * @tparam OutputIterator writable iterator.
-     * @param outValues partial results for each point
-     * @param result writable iterator over a container which stores estimated tangent directions.
+     * @brief Computes the tangent directions of a part of the range
+     * in one sweep over the maximal segments.
+     *
+     * @param segments the maximal segments of the range, in order.
+     * @param firsts the index of the first point of each segment, from the beginning of the curve.
+     * @param lasts the index after the last point of each segment.
+     * @param first the index of the first point of the part.
+     * @param last the index after the last point of the part.
+     * @param origin the index of the first point of the evaluated range.
+     * @param tangents (modified) the tangent directions of the evaluated range.
      */
-    template <typename OutputIterator>
-    void accumulate ( std::vector < Value > & outValues, OutputIterator & result );
+    void evalRange ( const std::vector < SegmentComputer > & segments,
+                     const std::vector < Index > & firsts,
+                     const std::vector < Index > & lasts,
+                     Index first, Index last, Index origin,
+                     std::vector < RealVector > & tangents ) const;
     
     // ------------------------- Private Datas --------------------------------
   private:
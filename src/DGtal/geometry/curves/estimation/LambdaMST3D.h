@@ -40,7 +40,6 @@
 #include <iterator>
 #include <cmath>
 #include <vector>
-#include <map>
 #include <DGtal/base/Common.h>
 #include <DGtal/helpers/StdDefs.h>
 #include "DGtal/kernel/CSpace.h"
@@ -120,6 +119,11 @@ namespace DGtal {
     /**
      * @tparam OutputIterator writable iterator.
      * More efficient way to compute tangent directions for all points of a curve.
+     * The maximal segments are computed once, and the points are then
+     * swept in order, each one knowing the interval of the segments
+     * containing it. The partial results of the points are computed by
+     * chunks of points in parallel when DGtal is built with OpenMP,
+     * and stored contiguously.
      *
      * @param itb begin iterator
      * @param ite end iterator
@@ -139,6 +143,9 @@ namespace DGtal {
 
       typedef typename std::vector<SegmentComputer >::const_iterator OrphanDSSIterator;
     
+    /// Index of a point in the evaluated range.
+    typedef std::size_t Index;
+
     /**
      * @brief Accumulate partial results obtained for each point.
      * In 3D it can happen that DSSs' direction vectors over same point are opposite.
@@ -147,13 +154,35 @@ namespace DGtal {
      * Finally, tangent direction is estimated and stored.
      * 
      * @tparam OutputIterator writable iterator.
-     * @param outValues partial results for each point
-     * @param itb begin iterator
-     * @param ite end iterator
+     * @param partials partial results, those of point i lying in [starts[i],starts[i+1])
+     * @param starts the index of the first partial result of each point, and the number of partial results.
      * @param result writable iterator over a container which stores estimated tangent directions.
      */
     template <typename OutputIterator>
-    void accumulate ( std::multimap < Point, Value > & outValues, ConstIterator itb, ConstIterator ite, OutputIterator & result );
+    void accumulate ( const std::vector < Value > & partials, const std::vector < Index > & starts,
+                      OutputIterator & result ) const;
+
+    /**
+     * @brief Computes the partial results of the unfiltered segments
+     * for a part of the range, in one sweep over the segments.
+     *
+     * @param segments the maximal segments of the range, in order.
+     * @param filtered whether each segment is filtered out.
+     * @param firsts the index of the first point of each segment, from the beginning of the curve.
+     * @param lasts the index after the last point of each segment.
+     * @param starts the index of the first partial result of each point of the evaluated range.
+     * @param first the index of the first point of the part.
+     * @param last the index after the last point of the part.
+     * @param origin the index of the first point of the evaluated range.
+     * @param partials (modified) the partial results.
+     */
+    void evalPartials ( const std::vector < SegmentComputer > & segments,
+                        const std::vector < bool > & filtered,
+                        const std::vector < Index > & firsts,
+                        const std::vector < Index > & lasts,
+                        const std::vector < Index > & starts,
+                        Index first, Index last, Index origin,
+                        std::vector < Value > & partials ) const;
 
     /**
      * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
@@ -164,10 +193,17 @@ namespace DGtal {
      * @return estimated tangent
      */
     Value treatOrphan(OrphanDSSIterator begin, OrphanDSSIterator end, const Point &p);
-    template < typename DSSesIterator, typename OrphanIterator >
 
-    void treatOrphans(DSSesIterator begin, DSSesIterator end, OrphanIterator obegin, OrphanIterator oend,
-                       std::multimap<Point, Value> &outValues);
+    /**
+     * @brief Use the DSS filter defined conditions to ensure estimation over not covered points - orphans.
+     *
+     * @param segments the maximal segments of the range, in order.
+     * @param orphans the orphan points.
+     * @param orphanPartials (returns) the partial results of each orphan.
+     */
+    void treatOrphans ( const std::vector < SegmentComputer > & segments,
+                        const std::vector < Point > & orphans,
+                        std::vector < std::vector < Value > > & orphanPartials );
 
 
     // ------------------------- Private Datas --------------------------------
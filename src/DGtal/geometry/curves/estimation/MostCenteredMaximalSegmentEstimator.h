@@ -191,8 +191,8 @@ namespace DGtal
      * @param itb subrange begin iterator
      * @param ite subrange end iterator     
      * @param itCurrent current iterator
-     * @param first iterator on the first maximal segment
-     * @param last iterator on the last maximal segment
+     * @param first the first maximal segment
+     * @param last the last maximal segment
      * @param result output iterator on the estimated quantity
      *
      * @return the estimated quantity
@@ -201,19 +201,30 @@ namespace DGtal
      */
     template <typename OutputIterator>
     OutputIterator endEval(const ConstIterator& itb, const ConstIterator& ite, ConstIterator& itCurrent, 
-			   SegmentIterator& first, SegmentIterator& last, 
+			   const SegmentComputer& first, const SegmentComputer& last, 
 			   OutputIterator result); 
 
     template <typename OutputIterator>
     OutputIterator endEval(const ConstIterator& /*itb*/, const ConstIterator& ite, ConstIterator& itCurrent, 
-			   SegmentIterator& /*first*/, SegmentIterator& last, 
+			   const SegmentComputer& /*first*/, const SegmentComputer& last, 
 			   OutputIterator result, IteratorType); 
 
     template <typename OutputIterator>
     OutputIterator endEval(const ConstIterator& itb, const ConstIterator& ite, ConstIterator& itCurrent, 
-			   SegmentIterator& first, SegmentIterator& last, 
+			   const SegmentComputer& first, const SegmentComputer& last, 
 			   OutputIterator result, CirculatorType); 
 
+    /**
+     * Checks whether the two elements preceding and following @a it
+     * form a segment, i.e. whether two consecutive maximal segments
+     * meeting at @a it intersect (see
+     * SaturatedSegmentation::SegmentComputerIterator::intersectNext).
+     *
+     * @param it any iterator which is not the beginning of the range.
+     * @return 'true' if --it and it form a valid segment.
+     */
+    bool intersectAt(const ConstIterator& it) const;
+
     // ------------------------- Hidden services ------------------------------
 
   private:
@@ -50,6 +50,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 #include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -134,7 +135,7 @@ namespace DGtal
     typedef typename PointSet::const_iterator ConstIterator;
     typedef typename PointSet::iterator Iterator;
     typedef TInternalInteger InternalInteger;
-    typedef IntegerComputer< InternalInteger > MyIntegerComputer;
+    typedef typename IntegerComputerSelector< InternalInteger >::Type MyIntegerComputer;
     typedef COBANaivePlaneComputer< Space, InternalInteger > COBAComputer;
     typedef typename COBAComputer::Primitive Primitive;
 
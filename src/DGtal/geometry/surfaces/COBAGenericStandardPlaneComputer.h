@@ -49,6 +49,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 #include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -141,7 +142,7 @@ namespace DGtal
     typedef typename PointSet::const_iterator PointSetConstIterator;
     typedef typename PointSet::iterator PointSetIterator;
     typedef TInternalInteger InternalInteger;
-    typedef IntegerComputer< InternalInteger > MyIntegerComputer;
+    typedef typename IntegerComputerSelector< InternalInteger >::Type MyIntegerComputer;
     typedef COBANaivePlaneComputer< Space, InternalInteger > COBAComputer;
     typedef typename COBAComputer::Primitive Primitive;
     typedef typename COBAComputer::IntegerVector3 IntegerVector3;
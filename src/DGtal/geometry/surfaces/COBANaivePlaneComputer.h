@@ -50,6 +50,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 #include "DGtal/arithmetic/LatticePolytope2D.h"
 #include "DGtal/geometry/surfaces/ParallelStrip.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -94,7 +95,9 @@ namespace DGtal
    * Note on execution times: The user should favor int64_t instead of
    * BigInteger whenever possible (diameter smaller than 500). The
    * speed-up is between 10 and 20 for these diameters. For greater
-   * diameters, it is necessary to use BigInteger (see below).
+   * diameters, use int128_t (when the compiler provides it,
+   * WITH_INT128), which is still allocation-free and about ten times
+   * faster than BigInteger, and BigInteger beyond (see below).
    *
    * @tparam TSpace specifies the type of digital space in which lies
    * input digital points. A model of CSpace.
@@ -103,7 +106,8 @@ namespace DGtal
    * internal computations. The type should be able to hold integers
    * of order (2*D^3)^2 if D is the diameter of the set of digital
    * points. In practice, diameter is limited to 20 for int32_t,
-   * diameter is approximately 500 for int64_t, and whatever with
+   * diameter is approximately 500 for int64_t, approximately 10^6 for
+   * int128_t, and whatever with
    * BigInteger/GMP integers. For huge diameters, the slow-down is
    * polylogarithmic with respect to the diameter.
    *
@@ -142,7 +146,7 @@ namespace DGtal
     typedef typename PointSet::const_iterator ConstIterator;
     typedef typename PointSet::iterator Iterator;
     typedef TInternalInteger InternalInteger;
-    typedef IntegerComputer< InternalInteger > MyIntegerComputer;
+    typedef typename IntegerComputerSelector< InternalInteger >::Type MyIntegerComputer;
     typedef ParallelStrip<Space, true, true> Primitive;
     typedef PointVector< 3, InternalInteger > IntegerVector3;
 
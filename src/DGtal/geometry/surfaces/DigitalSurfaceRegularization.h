@@ -238,6 +238,10 @@ namespace DGtal
      * gradient vector (and the default function is thus @f$ p \leftarrow p + v@f$ with
      * @f$ v = -dt  \nabla E_p@f$). See @see clampedAdvection for another advection strategy.
      *
+     * Gradient computations and advections are processed in parallel
+     * when OpenMP is enabled: the advection function is then called
+     * concurrently on distinct points.
+     *
      * The energy at the final step is returned.
      *
      * @param [in] nbIters maxium number of steps
@@ -411,6 +415,25 @@ namespace DGtal
      */
     void cacheInit();
     
+    /**
+     * Compute the energy gradient vector, its @f$l_\infty@f$ norm and
+     * the energy value, in parallel over blocks of surfels and
+     * pointels.
+     *
+     * @param [in] localWeights if true, use the local weights given to
+     * init(alphas,betas,gammas), otherwise the constant ones.
+     * @param [out] gradientNorm the @f$l_\infty@f$ norm of the gradient.
+     * @return the energy value.
+     */
+    double computeGradientAndNorm(const bool localWeights,
+                                  double & gradientNorm);
+    
+    /**
+     * @param [in] length a number of elements.
+     * @return the number of blocks of elements processed in parallel.
+     */
+    static long nbBlocks(const long length);
+    
     
     // ------------------------- Private Datas --------------------------------
   private:
@@ -458,8 +481,8 @@ namespace DGtal
     // ---------------------------------------------------------------
     ///Internal members to store precomputed topological informations
     
-    ///Gradient of the quad alignement w.r.t. vertex positons
-    Positions myGradientAlign;
+    ///Projections of the quad edges onto the surfel normals, grouped by starting pointel
+    std::vector<double> myAlignProjections;
     
     ///Instance of the KSpace
     SH3::KSpace myK;
@@ -477,12 +500,20 @@ namespace DGtal
     std::vector< SH3::Idx > myAlignPointelsIdx;
     ///Adjacent pointels for the Alignement energy term
     std::vector< SH3::Cell > myAlignPointels;
-    ///Number of adjacent edges to pointels
-    std::vector<unsigned char> myNumberAdjEdgesToPointel;
-    ///Indices of cells foor the Fairness term
+    ///Offsets of the quad edges starting at each pointel in myAlignProjections
+    std::vector< std::size_t > myAlignOffsets;
+    ///Slot in myAlignProjections of each quad edge (same indexing as myAlignPointelsIdx)
+    std::vector< std::size_t > myAlignSlots;
+    ///Surfel of the quad edge in each slot of myAlignProjections
+    std::vector< SH3::Idx > myAlignSurfels;
+    ///Offsets of the faces centered at each pointel in myFairnessFaces
+    std::vector< std::size_t > myFairnessOffsets;
+    ///Faces of the dual digital surface, grouped by center pointel
+    std::vector< std::size_t > myFairnessFaces;
+    ///Offsets of the adjacent pointels of each face in myFairnessPointelsIdx
+    std::vector< std::size_t > myFairnessFaceOffsets;
+    ///Indices of adjacent pointels for the Fairness term
     std::vector< SH3::Idx > myFairnessPointelsIdx;
-    ///Number of adjacent faces to given vertex
-    std::vector< unsigned char > myNbAdjacent;
     ///All faces of the dual digital surfacce
     SH3::PolygonalSurface::FaceRange myFaces;
     
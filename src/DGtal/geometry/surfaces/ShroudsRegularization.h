@@ -196,7 +196,11 @@ namespace DGtal {
     RealPoints positions() const
     {
       RealPoints result( myT.size() );
-      for ( Vertex v = 0; v < myT.size(); ++v )
+      const long nbV = myT.size();
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for ( long v = 0; v < nbV; ++v )
 	result[ v ] = position( v );
       return result;
     }
@@ -240,18 +244,20 @@ namespace DGtal {
     /// @{
 
     /// Computes the distances between the vertices along slices.
+    /// The slices of each direction are processed in parallel when
+    /// OpenMP is enabled.
     void parameterize()
     {
-      Scalar d = 0.0;
-      // Vertex n = 0;
+      const long nbV = myT.size();
       for ( Dimension i = 0; i < 3; ++i )
-	for ( Vertex v = 0; v < myT.size(); ++v )
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for ( long v = 0; v < nbV; ++v )
 	  {
 	    if ( myNext[ i ][ v ] == myInvalid )  continue; // not a valid slice
 	    myNextD[ i ][ v ] = ( position( myNext[ i ][ v ] ) - position( v ) ).norm();
 	    myPrevD[ i ][ v ] = ( position( myPrev[ i ][ v ] ) - position( v ) ).norm();
-	    d += myNextD[ i ][ v ];
-	    //	    n += 1;
 	  }
     }
 
@@ -525,6 +531,25 @@ namespace DGtal {
 	}
     }
 
+    /// @param randomization the amplitude of the perturbation.
+    /// @return the random perturbations of the parameters of all
+    /// vertices for one optimization step, drawn sequentially with \c
+    /// rand() so that the parallel optimization steps give the same
+    /// results as sequential ones.
+    Scalars randomShifts( const double randomization ) const;
+
+    /// Damps the parameters toward the new ones, forces them to stay
+    /// in ]0,1[ and measures the vertex displacements, in one pass.
+    ///
+    /// @param newT the new parameters computed by an optimization step.
+    /// @param newWeight the weight of the new parameters.
+    /// @param oldWeight the weight of the current parameters.
+    ///
+    /// @return the pair of \f$ l_\infty \f$ and \f$ l_2 \f$ norms of
+    /// vertex displacements.
+    std::pair<double,double> updateParameters
+    ( const Scalars& newT, const double newWeight, const double oldWeight );
+
     /// @}
     
     // -------------------------- data ---------------------------------
@@ -41,10 +41,12 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
 #include "DGtal/kernel/Point2ScalarFunctors.h"
 #include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/math/linalg/BatchEigenDecomposition3D.h"
 #include "DGtal/topology/CDigitalSurfaceContainer.h"
 #include "DGtal/topology/DigitalSurface.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
@@ -280,6 +282,26 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Diagonalizes the VCM of each point and stores them in
+     * myPt2EigenStructure, all at once in 3D, one by one otherwise.
+     *
+     * @param points the points.
+     * @param measures the VCM of each point.
+     */
+    void diagonalize( const std::vector<Point> & points,
+                      const std::vector<MatrixNN> & measures );
+
+    /// Diagonalizes the VCM one by one with LinearAlgebraTool (nD).
+    void diagonalize( const std::vector<Point> & points,
+                      const std::vector<MatrixNN> & measures,
+                      std::false_type );
+
+    /// Diagonalizes the VCM all at once with BatchEigenDecomposition3D.
+    void diagonalize( const std::vector<Point> & points,
+                      const std::vector<MatrixNN> & measures,
+                      std::true_type );
+
   }; // end of class VoronoiCovarianceMeasureOnDigitalSurface
 
 
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchConvexHull2D.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BatchConvexHull2D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchConvexHull2D_RECURSES)
+#error Recursive header files inclusion detected in BatchConvexHull2D.h
+#else // defined(BatchConvexHull2D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchConvexHull2D_RECURSES
+
+#if !defined BatchConvexHull2D_h
+/** Prevents repeated inclusion of headers. */
+#define BatchConvexHull2D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchConvexHull2D
+  /**
+     Description of template class 'BatchConvexHull2D' <p> \brief
+     Aim: Computes the convex hulls (and their thickness) of many
+     small sets of 2D integer points at once.
+
+     The sets are given in a structure-of-arrays layout: two arrays of
+     x- and y-coordinates and an array of offsets, the k-th set being
+     made of the points of indices [offsets[k],offsets[k+1]). The
+     hulls are returned in the same layout. This avoids the copies,
+     the containers and the calls through predicates that
+     functions::Hull2D::andrewConvexHullAlgorithm performs for each
+     set, which dominate when the sets have a few dozen points.
+
+     Each hull is computed by Andrew's monotone chain. The orientation
+     tests first evaluate the determinant of the coordinate
+     differences in double precision, which is exact for small
+     coordinates and filtered by an error bound otherwise; only when
+     the sign is not certified, they fall back on the exact sign
+     computation of AvnaimEtAl2x2DetSignComputer. The sets are
+     processed by blocks, in parallel when DGtal is built with OpenMP.
+
+     Each hull is the sequence of its strictly convex vertices,
+     counterclockwise, starting from its smallest point
+     (lexicographically). It has one vertex if all the points of the
+     set are equal and two vertices if they are collinear. It is
+     thus, up to a rotation, the hull returned by
+     functions::Hull2D::andrewConvexHullAlgorithm with a predicate
+     accepting strict left turns only (e.g. InHalfPlaneBySimple3x3Matrix).
+
+     @code
+     std::vector<Z2i::Integer> xs, ys;   // coordinates of all the points
+     std::vector<std::size_t> offsets;   // nbSets + 1 offsets
+     BatchConvexHull2D<Z2i::Integer> batch;
+     batch.compute( xs, ys, offsets );
+     std::vector<double> thicknesses;
+     batch.computeThicknesses( thicknesses, functions::Hull2D::EuclideanThickness );
+     @endcode
+
+     @tparam TInteger the type of the coordinates, a model of
+     concepts::CInteger with native arithmetic (e.g. DGtal::int32_t,
+     DGtal::int64_t). The differences of coordinates of a set must be
+     representable by TInteger.
+
+     @see Hull2DHelpers.h, testBatchConvexHull2D.cpp
+   */
+  template <typename TInteger>
+  class BatchConvexHull2D
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TInteger Integer;
+    typedef PointVector<2, Integer> Point;
+    typedef std::size_t Index;
+    typedef functions::Hull2D::ThicknessDefinition ThicknessDefinition;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The object has no set.
+    */
+    BatchConvexHull2D();
+
+    /**
+       Computes the convex hulls of the given sets of points.
+
+       @param xs the x-coordinates of the points of all the sets.
+       @param ys the y-coordinates of the points of all the sets.
+       @param offsets the offsets of the sets in @a xs and @a ys (one
+       more than the number of sets, the last one being the number of
+       points). A set may be empty.
+       @param nbBlocks the number of blocks of sets processed
+       independently, 0 means a few blocks per available thread.
+    */
+    void compute( const std::vector<Integer> & xs,
+                  const std::vector<Integer> & ys,
+                  const std::vector<Index> & offsets,
+                  unsigned int nbBlocks = 0 );
+
+    /**
+       Computes the thickness of each hull.
+
+       @param thicknesses (returns) the thickness of each hull (0 for
+       hulls with less than three vertices).
+       @param def the definition of the thickness.
+       @param nbBlocks the number of blocks of hulls processed
+       independently, 0 means a few blocks per available thread.
+
+       @see functions::Hull2D::computeHullThickness
+    */
+    void computeThicknesses( std::vector<double> & thicknesses,
+                             const ThicknessDefinition & def,
+                             unsigned int nbBlocks = 0 ) const;
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the number of sets.
+    Index size() const;
+
+    /**
+       @param k the index of a set.
+       @return the number of vertices of its hull.
+    */
+    Index hullSize( Index k ) const;
+
+    /**
+       @param k the index of a set.
+       @param i the index of a vertex of its hull.
+       @return this vertex.
+    */
+    Point vertex( Index k, Index i ) const;
+
+    /**
+       Outputs the vertices of a hull.
+
+       @tparam OutputIterator a model of output iterator on Point.
+       @param k the index of a set.
+       @param out the output iterator.
+       @return the output iterator after the last vertex.
+    */
+    template <typename OutputIterator>
+    OutputIterator hull( Index k, OutputIterator out ) const;
+
+    /**
+       @param k the index of a set.
+       @param def the definition of the thickness.
+       @return the thickness of its hull.
+    */
+    double thickness( Index k, const ThicknessDefinition & def ) const;
+
+    /// @return the x-coordinates of the vertices of all the hulls.
+    const std::vector<Integer> & hullXs() const;
+
+    /// @return the y-coordinates of the vertices of all the hulls.
+    const std::vector<Integer> & hullYs() const;
+
+    /// @return the offsets of the hulls (one more than the number of sets).
+    const std::vector<Index> & hullOffsets() const;
+
+    /// @return the number of orientation tests of the last
+    /// computation that needed the exact computation.
+    Index nbExactTests() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Writes/Displays the object on an output stream.
+       @param out the output stream where the object is written.
+    */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+       Checks the validity/consistency of the object.
+       @return 'true' if the object is valid, 'false' otherwise.
+    */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Exact sign of 2x2 determinants.
+    typedef AvnaimEtAl2x2DetSignComputer<Integer> ExactComputer;
+
+    /**
+       Sign of the orientation of three points, i.e. of the
+       determinant of (b-a, c-a).
+
+       @param a the first point.
+       @param b the second point.
+       @param c the third point.
+       @param exact the exact computer, used when the floating-point
+       sign is not certified.
+       @param nbExact (modified) incremented when @a exact is used.
+       @return 1 for a left turn, -1 for a right turn, 0 if the
+       points are collinear.
+    */
+    static int orientation( const Point & a, const Point & b, const Point & c,
+                            ExactComputer & exact, Index & nbExact );
+
+    /**
+       Computes the hull of points by Andrew's monotone chain.
+
+       @param points (modified) the points, sorted and made unique.
+       @param hull (returns) the vertices of the hull.
+       @param exact the exact computer.
+       @param nbExact (modified) the number of exact tests.
+    */
+    static void monotoneChain( std::vector<Point> & points,
+                               std::vector<Point> & hull,
+                               ExactComputer & exact, Index & nbExact );
+
+    /**
+       @param nbBlocks a number of blocks, 0 for the default.
+       @param n the number of items.
+       @return the number of blocks to process @a n items.
+    */
+    static Index blockNumber( unsigned int nbBlocks, Index n );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The x-coordinates of the vertices of the hulls.
+    std::vector<Integer> myXs;
+    /// The y-coordinates of the vertices of the hulls.
+    std::vector<Integer> myYs;
+    /// The offsets of the hulls.
+    std::vector<Index> myOffsets;
+    /// The number of exact orientation tests.
+    Index myNbExact;
+
+  }; // end of class BatchConvexHull2D
+
+  /**
+     Overloads 'operator<<' for displaying objects of class 'BatchConvexHull2D'.
+     @param out the output stream where the object is written.
+     @param object the object of class 'BatchConvexHull2D' to write.
+     @return the output stream after the writing.
+  */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchConvexHull2D<TInteger> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/tools/BatchConvexHull2D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchConvexHull2D_h
+
+#undef BatchConvexHull2D_RECURSES
+#endif // else defined(BatchConvexHull2D_RECURSES)
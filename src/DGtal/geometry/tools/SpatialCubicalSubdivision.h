@@ -45,6 +45,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Clone.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/kernel/PointVectorSoA.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -81,6 +82,7 @@ namespace DGtal
     typedef std::vector<Point> Storage;
     typedef ImageContainerBySTLVector<Domain,Storage*> StorageArray;
     typedef typename StorageArray::ConstRange BinConstRange;
+    typedef PointVectorSoA<Point> PointBuffer;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -150,6 +152,16 @@ namespace DGtal
     template <typename PointConstIterator>
     void push( PointConstIterator it, PointConstIterator itE );
 
+    /**
+       Pushes all the points of the structure-of-arrays buffer \a
+       pts into the corresponding bins. The bins of all points are
+       computed first, one dimension at a time, with loops that the
+       compiler may vectorize, then the points are dispatched.
+
+       @param pts a buffer of points, all within domain().
+    */
+    void push( const PointBuffer& pts );
+
     /**
        Pushes back in \a pts all the points in the bin domain [\a
        bin_lo, \a bin_up] which satisfy the predicate \a pred.
@@ -48,6 +48,7 @@
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
 #include "DGtal/arithmetic/ClosedIntegerHalfPlane.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -524,7 +525,11 @@ namespace DGtal
      *
      * @return the number of integer points lying within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note The bounding box is scanned by lines parallel to its
+     * longest axis. On each line, the constraints are clipped to an
+     * interval of integers whose length is counted, so that the
+     * points are never enumerated. Lines are processed in parallel
+     * when DGtal is built with OpenMP.
      */
     Integer count() const;
 
@@ -533,7 +538,7 @@ namespace DGtal
      *
      * @return the number of integer points lying within the interior of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Counted by lines of the bounding box, like count().
      * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
@@ -545,7 +550,7 @@ namespace DGtal
      *
      * @return the number of integer points lying on the boundary of the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Counted by lines of the bounding box, like count().
      * 
      * @note `count() <= countInterior() + countBoundary()` with
      * equality when the polytope is closed.
@@ -560,7 +565,7 @@ namespace DGtal
      * @param[in] hi the highest point of the domain.
      * @return the number of integer points within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Counted by lines of the bounding box, like count().
      */
     Integer countWithin( Point low, Point hi ) const;
 
@@ -578,7 +583,8 @@ namespace DGtal
      *
      * @return the number of integer points within the polytope up to .
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note The bounding box is scanned sequentially by lines, whose
+     * intervals of points are counted, until \a max is reached.
      */
     Integer countUpTo( Integer max ) const;
 
@@ -587,7 +593,10 @@ namespace DGtal
      *
      * @param[out] pts the integer points within the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note The bounding box is scanned by lines parallel to the
+     * first axis, on which the points form an interval. Lines are
+     * processed in parallel when DGtal is built with OpenMP. The
+     * points are in the order of the domain.
      * @note At output, pts.size() == this->count()
      */
     void getPoints( std::vector<Point>& pts ) const;
@@ -597,7 +606,7 @@ namespace DGtal
      *
      * @param[out] pts the integer points interior to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Enumerated by lines, like getPoints.
      * @note At output, pts.size() == this->countInterior()
      */
     void getInteriorPoints( std::vector<Point>& pts ) const;
@@ -607,7 +616,7 @@ namespace DGtal
      *
      * @param[out] pts the integer points boundary to the polytope.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note Enumerated by lines, like getPoints.
      * @note At output, pts.size() == this->countBoundary()
      */
     void getBoundaryPoints( std::vector<Point>& pts ) const;
@@ -620,7 +629,7 @@ namespace DGtal
      * @param[in,out] pts_set the set of points where points within
      * this polytope are inserted.
      *
-     * @note Quite slow: obtained by checking every point of the polytope domain.
+     * @note The points are enumerated like in getPoints.
      */
     template <typename PointSet>
     void insertPoints( PointSet& pts_set ) const;
@@ -673,6 +682,72 @@ namespace DGtal
 
     // ------------------------- Internals ------------------------------------
   private:
+    /// The constraints defining the points of a line (see lineInterval).
+    enum LineConstraints {
+      InsideLine,   ///< points of the domain inside the polytope (see isDomainPointInside)
+      InteriorLine, ///< points interior to the polytope (see isInterior)
+      ClosedLine    ///< points inside the closed polytope, i.e. interior or boundary
+    };
+
+    /// The integer computer used to clip the lines.
+    typedef typename IntegerComputerSelector<Integer>::Type LineIntegerComputer;
+
+    /// @param lo the lowest point of a domain.
+    /// @param hi the highest point of a domain.
+    /// @param k a dimension.
+    /// @return the number of lines of the domain parallel to axis \a k.
+    static std::size_t nbLines( const Point& lo, const Point& hi, Dimension k );
+
+    /// @param lo the lowest point of a domain.
+    /// @param hi the highest point of a domain.
+    /// @param k a dimension.
+    /// @param l the index of a line parallel to axis \a k, lines being
+    /// ordered like the points of the domain.
+    /// @return the first point of this line.
+    static Point linePoint( const Point& lo, const Point& hi, Dimension k, std::size_t l );
+
+    /// @param n a number of lines.
+    /// @return the number of blocks of lines processed in parallel.
+    static std::size_t nbLineBlocks( std::size_t n );
+
+    /// Computes the integers x of [lo[k],hi[k]] such that the point
+    /// \a p, with \a x as k-th coordinate, satisfies the constraints
+    /// of type \a type. They form an interval.
+    ///
+    /// @param p any point (its k-th coordinate is ignored).
+    /// @param k the axis of the line.
+    /// @param type the kind of constraints.
+    /// @param lo the lowest bound of the interval.
+    /// @param hi the highest bound of the interval.
+    /// @param[out] x0 the first integer of the interval.
+    /// @param[out] x1 the last integer of the interval.
+    /// @param ic the integer computer used for divisions.
+    /// @return 'true' iff the interval is not empty.
+    bool lineInterval( Point p, Dimension k, LineConstraints type,
+                       Integer lo, Integer hi, Integer& x0, Integer& x1,
+                       const LineIntegerComputer& ic ) const;
+
+    /// Counts the integer points of the domain [lo,hi] satisfying
+    /// constraints of type \a type, by lines along the longest axis.
+    ///
+    /// @param lo the lowest point of a domain.
+    /// @param hi the highest point of a domain.
+    /// @param type the kind of constraints.
+    /// @return the number of these points.
+    Integer countOnLines( const Point& lo, const Point& hi,
+                          LineConstraints type ) const;
+
+    /// Computes the integer points of the domain satisfying
+    /// constraints of type \a type (or on the boundary if \a
+    /// boundary is 'true'), by lines along the first axis.
+    ///
+    /// @param[out] pts the points, in the order of the domain.
+    /// @param type the kind of constraints.
+    /// @param boundary when 'true', outputs the points satisfying
+    /// constraints of type ClosedLine but not InteriorLine.
+    void getPointsOnLines( std::vector<Point>& pts, LineConstraints type,
+                           bool boundary = false ) const;
+
     /// In 3D, builds a valid lattice polytope with empty interior
     /// from 3 non-colinear points.
     /// @param a any point such that a, b, and c are not colinear.
@@ -0,0 +1,356 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file IncrementalDigitalConvexity.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module IncrementalDigitalConvexity.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(IncrementalDigitalConvexity_RECURSES)
+#error Recursive header files inclusion detected in IncrementalDigitalConvexity.h
+#else // defined(IncrementalDigitalConvexity_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define IncrementalDigitalConvexity_RECURSES
+
+#if !defined IncrementalDigitalConvexity_h
+/** Prevents repeated inclusion of headers. */
+#define IncrementalDigitalConvexity_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
+#include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
+#include "DGtal/geometry/volumes/BoundedRationalPolytope.h"
+#include "DGtal/geometry/volumes/CellGeometry.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class IncrementalDigitalConvexity
+  /**
+     Description of template class 'IncrementalDigitalConvexity' <p>
+     \brief Aim: Checks the digital k-convexity and full convexity of
+     a digital set that changes by insertions and removals of points.
+
+     DigitalConvexity::isKConvex and DigitalConvexity::isFullyConvex
+     rebuild the cells touching the lattice points of a polytope at
+     each call. This class instead maintains the cells touching its
+     set of points X (the star of X), each with the number of points
+     of X touching it, together with the number of cells of each
+     dimension. Cells and counts are stored in a single hash map keyed
+     by the Khalimsky points of the cells: UnorderedSetByBlock, used
+     by CellGeometry, only stores keys, so that the counts would have
+     to be kept in a second container duplicating every cell.
+     Adding or removing a point only updates the cells of its star, so
+     that removals are supported. A check against a polytope P then
+     only computes the cells intersected by P, compares their number
+     to the maintained count and looks each of them up.
+
+     @code
+     typedef KhalimskySpaceND<3,int> KSpace;
+     IncrementalDigitalConvexity<KSpace> X( KSpace::Point( -10, -10, -10 ),
+                                            KSpace::Point(  10,  10,  10 ) );
+     DigitalConvexity<KSpace> dconv( X.space() );
+     auto P = dconv.makeSimplex( { a, b, c, d } );
+     auto S = dconv.insidePoints( P );
+     X.addPoints( S.begin(), S.end() );
+     bool cvx = X.isFullyConvex( P ); // same as dconv.isFullyConvex( P )
+     X.removePoint( S.back() );
+     @endcode
+
+     It is a model of boost::CopyConstructible,
+     boost::DefaultConstructible, boost::Assignable.
+
+     @tparam TKSpace an arbitrary model of CCellularGridSpaceND.
+
+     @see DigitalConvexity, CellGeometry
+   */
+  template < typename TKSpace >
+  class IncrementalDigitalConvexity
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+  public:
+    typedef IncrementalDigitalConvexity<TKSpace> Self;
+    typedef TKSpace                         KSpace;
+    typedef typename KSpace::Integer        Integer;
+    typedef typename KSpace::Point          Point;
+    typedef typename KSpace::Vector         Vector;
+    typedef typename KSpace::Cell           Cell;
+    typedef typename KSpace::Space          Space;
+    typedef typename KSpace::Size           Size;
+    typedef DGtal::BoundedLatticePolytope < Space > LatticePolytope;
+    typedef DGtal::BoundedRationalPolytope< Space > RationalPolytope;
+    typedef DGtal::CellGeometry< KSpace >   CellGeometry;
+    /// The type of set used to store points and cells (as Khalimsky points).
+    typedef UnorderedSetByBlock< Point, Splitter< Point, uint64_t > > PointSet;
+    /// The type of map associating to the Khalimsky point of each cell
+    /// the number of points touching it.
+    typedef std::unordered_map< Point, Size > KPointCounts;
+
+    static const Dimension dimension = KSpace::dimension;
+
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+
+    /**
+     * Destructor.
+     */
+    ~IncrementalDigitalConvexity() = default;
+
+    /**
+     * Constructor. The object is empty.
+     */
+    IncrementalDigitalConvexity();
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    IncrementalDigitalConvexity ( const Self & other ) = default;
+
+    /**
+     * Constructor from cellular space. The set of points is empty.
+     * @param K any cellular grid space.
+     */
+    IncrementalDigitalConvexity( Clone<KSpace> K );
+
+    /**
+     * Constructor from lower and upper points. The set of points is empty.
+     * @param lo the lowest point of the domain (bounding box for computations).
+     * @param hi the highest point of the domain (bounding box for computations).
+     */
+    IncrementalDigitalConvexity( Point lo, Point hi );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( const Self & other ) = default;
+
+    /// Removes all the points.
+    void clear();
+
+    /// @return a const reference to the cellular grid space used by this object.
+    const KSpace& space() const;
+
+    /// @}
+
+    // ----------------------- Point services ------------------------------
+  public:
+    /// @name Point services
+    /// @{
+
+    /// Adds a point to the set and the cells it touches to the cover.
+    ///
+    /// @param p any point of the space.
+    /// @return 'true' iff \a p was not already in the set.
+    bool addPoint( const Point& p );
+
+    /// Removes a point from the set, and the cells that no other
+    /// point of the set touches from the cover.
+    ///
+    /// @param p any point of the space.
+    /// @return 'true' iff \a p was in the set.
+    bool removePoint( const Point& p );
+
+    /// Adds a range of points.
+    ///
+    /// @tparam PointIterator any model of forward iterator on Point.
+    /// @param itB the start of the range.
+    /// @param itE past the end of the range.
+    template <typename PointIterator>
+    void addPoints( PointIterator itB, PointIterator itE );
+
+    /// Removes a range of points.
+    ///
+    /// @tparam PointIterator any model of forward iterator on Point.
+    /// @param itB the start of the range.
+    /// @param itE past the end of the range.
+    template <typename PointIterator>
+    void removePoints( PointIterator itB, PointIterator itE );
+
+    /// @param p any point of the space.
+    /// @return 'true' iff \a p is in the set.
+    bool contains( const Point& p ) const;
+
+    /// @return the number of points of the set.
+    Size nbPoints() const;
+
+    /// @return the points of the set.
+    const PointSet& points() const;
+
+    /// @}
+
+    // ----------------------- Cell services ------------------------------
+  public:
+    /// @name Cell services
+    /// @{
+
+    /// @return the number of cells touching the points of the set.
+    Size nbCells() const;
+
+    /// @param k any dimension, 0 <= k <= KSpace::dimension.
+    /// @return the number of k-cells touching the points of the set.
+    Size nbCells( Dimension k ) const;
+
+    /// @param kp the Khalimsky point of a cell.
+    /// @return the number of points of the set touching this cell.
+    Size nbTouchingPoints( const Point& kp ) const;
+
+    /// @return the Khalimsky points of the cells touching the points
+    /// of the set, each with its number of touching points.
+    const KPointCounts& kpoints() const;
+
+    /// @}
+
+    // ----------------------- Convexity services ------------------------------
+  public:
+    /// @name Convexity services
+    /// @{
+
+    /// Tells if the points of the set touch exactly the k-cells
+    /// intersected by the polytope \a P. When the set is the set of
+    /// lattice points of \a P, it is DigitalConvexity::isKConvex( P, k ),
+    /// except for k = 0, where it checks that the set is the set of
+    /// lattice points of \a P.
+    ///
+    /// @param P any lattice polytope such that `P.canBeSummed() == true`.
+    /// @param k any dimension, 0 <= k <= KSpace::dimension.
+    /// @return 'true' iff the k-cells touching the set are the k-cells intersected by \a P.
+    bool isKConvex( const LatticePolytope& P, const Dimension k ) const;
+
+    /// Tells if the points of the set touch exactly the k-cells
+    /// intersected by the polytope \a P, for 0 <= k < KSpace::dimension.
+    /// Hence the set is the set of lattice points of \a P and \a P
+    /// is fully digitally convex (see DigitalConvexity::isFullyConvex).
+    ///
+    /// @param P any lattice polytope such that `P.canBeSummed() == true`.
+    /// @return 'true' iff the set is the set of lattice points of \a P
+    /// and is fully digitally convex.
+    bool isFullyConvex( const LatticePolytope& P ) const;
+
+    /// Rational polytope version of isKConvex.
+    ///
+    /// @param P any rational polytope such that `P.canBeSummed() == true`.
+    /// @param k any dimension, 0 <= k <= KSpace::dimension.
+    /// @return 'true' iff the k-cells touching the set are the k-cells intersected by \a P.
+    bool isKConvex( const RationalPolytope& P, const Dimension k ) const;
+
+    /// Rational polytope version of isFullyConvex.
+    ///
+    /// @param P any rational polytope such that `P.canBeSummed() == true`.
+    /// @return 'true' iff the set is the set of lattice points of \a P
+    /// and is fully digitally convex.
+    bool isFullyConvex( const RationalPolytope& P ) const;
+
+    /// @}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+    /// @name Interface services
+    /// @{
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /// @}
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+    /// The cellular grid space for computations.
+    KSpace myK;
+    /// The set of points.
+    PointSet myPoints;
+    /// The Khalimsky points of the cells touching the points, each
+    /// with the number of points touching it.
+    KPointCounts myKPoints;
+    /// The number of cells of each dimension.
+    std::vector< Size > myNbCells;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+    /// Increments the reference count of a cell, inserting it if needed.
+    /// @param kp the Khalimsky point of a cell.
+    void refCell( const Point& kp );
+
+    /// Decrements the reference count of a cell, removing it if needed.
+    /// @param kp the Khalimsky point of a cell touching the points.
+    void unrefCell( const Point& kp );
+
+    /// Compares the k-cells intersected by a polytope with the cover.
+    /// @tparam TPolytope either LatticePolytope or RationalPolytope.
+    /// @param P any polytope such that `P.canBeSummed() == true`.
+    /// @param k any dimension.
+    /// @return 'true' iff they are the k-cells of the cover.
+    template <typename TPolytope>
+    bool internalIsKConvex( const TPolytope& P, const Dimension k ) const;
+
+  }; // end of class IncrementalDigitalConvexity
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'IncrementalDigitalConvexity'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'IncrementalDigitalConvexity' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const IncrementalDigitalConvexity<TKSpace> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/IncrementalDigitalConvexity.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined IncrementalDigitalConvexity_h
+
+#undef IncrementalDigitalConvexity_RECURSES
+#endif // else defined(IncrementalDigitalConvexity_RECURSES)
@@ -0,0 +1,346 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConnectedComponentLabeling.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ConnectedComponentLabeling.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ConnectedComponentLabeling_RECURSES)
+#error Recursive header files inclusion detected in ConnectedComponentLabeling.h
+#else // defined(ConnectedComponentLabeling_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConnectedComponentLabeling_RECURSES
+
+#if !defined ConnectedComponentLabeling_h
+/** Prevents repeated inclusion of headers. */
+#define ConnectedComponentLabeling_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CountedConstPtrOrConstPtr.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ConnectedComponentLabeling
+  /**
+   * Description of template class 'ConnectedComponentLabeling' <p>
+   * \brief Aim: Labels the connected components of an image stored in
+   * an ImageContainerBySTLVector, and gathers per-component
+   * statistics (number of points, bounding box).
+   *
+   * Two points are in the same component if they are adjacent and
+   * carry the same value, different from a given background
+   * value. Adjacency is given as in MetricAdjacency by the maximal
+   * 1-norm @a maxNorm1 of the difference between two points whose
+   * coordinates differ at most by one: 1 and 2 give the 4- and
+   * 8-adjacencies in 2D, 1, 2 and 3 give the 6-, 18- and
+   * 26-adjacencies in 3D. For a binary image, the components are thus
+   * the connected components of the foreground.
+   *
+   * Contrary to Object::writeComponents or to a BreadthFirstVisitor
+   * over a digital set, the algorithm works directly on the
+   * linearized image storage and does not allocate any point set:
+   *
+   * - the first pass scans the image and merges every foreground
+   *   point with its already visited neighbors in a union-find forest
+   *   indexed by the linearized point indices. Parents always have a
+   *   smaller index than their children (union by minimal index, path
+   *   halving). The image is cut into slabs along its last dimension,
+   *   which are scanned independently (in parallel when DGtal is
+   *   built with OpenMP), and the trees across the slab boundaries
+   *   are merged afterwards.
+   * - the second pass scans the image once more in storage order. A
+   *   point which is its own parent starts a new component, any other
+   *   point gets the label of its parent, which has already been
+   *   visited. Labels are thus consecutive, numbered from 1 in the
+   *   order of the first point of each component, and do not depend
+   *   on the number of slabs. Statistics are gathered during this
+   *   pass.
+   *
+   * The background gets the label 0.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Domain, unsigned char> Image;
+   * Image image( domain );
+   * ...
+   * ConnectedComponentLabeling<Domain, unsigned char> ccl( image, 3 ); // 26-adjacency in 3D
+   * trace.info() << ccl.numberOfComponents() << std::endl;
+   * const auto & labels = ccl.labelImage();
+   * const auto & stats  = ccl.statistics(); // stats[ l ] for label l
+   * @endcode
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue the type of the image values, equality comparable.
+   *
+   * @see testConnectedComponentLabeling.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ConnectedComponentLabeling
+  {
+  public:
+
+    typedef ConnectedComponentLabeling<TDomain, TValue> Self;
+    typedef TDomain Domain;
+    typedef TValue Value;
+    typedef ImageContainerBySTLVector<Domain, Value> Image;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< Space > >::value ) );
+
+    /// Type of the component labels.
+    typedef DGtal::uint32_t Label;
+    /// Type of the image of labels.
+    typedef ImageContainerBySTLVector<Domain, Label> LabelImage;
+    /// Index of a point in the linearized image storage.
+    typedef std::size_t Index;
+
+    /// Statistics of a connected component.
+    struct ComponentStatistics
+    {
+      /// Number of points of the component.
+      Size size;
+      /// Lower bound of the bounding box of the component.
+      Point lower;
+      /// Upper bound of the bounding box of the component.
+      Point upper;
+      /// Value of the image points of the component.
+      Value value;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. Labels the components of the given image.
+     *
+     * @param anImage the image to label (aliased).
+     * @param maxNorm1 the adjacency, see MetricAdjacency (1 for the
+     * 4-/6-adjacency, dimension for the 8-/26-adjacency).
+     * @param aBackground the value of the background points.
+     * @param nbSlabs the number of slabs scanned independently
+     * during the first pass, 0 means one slab per available thread.
+     */
+    ConnectedComponentLabeling( ConstAlias<Image> anImage,
+                                Dimension maxNorm1 = 1,
+                                const Value & aBackground = Value(),
+                                unsigned int nbSlabs = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~ConnectedComponentLabeling() = default;
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    ConnectedComponentLabeling( const ConnectedComponentLabeling & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ConnectedComponentLabeling & operator=( const ConnectedComponentLabeling & other ) = default;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /// @return the labeled image.
+    const Image & image() const;
+
+    /// @return the adjacency used for the labeling.
+    Dimension maxNorm1() const;
+
+    /// @return the background value.
+    const Value & background() const;
+
+    /**
+     * @return the image of the labels: 0 for the background, from 1
+     * to numberOfComponents() for the components.
+     */
+    const LabelImage & labelImage() const;
+
+    /// @return the number of (foreground) connected components.
+    Label numberOfComponents() const;
+
+    /**
+     * @return the statistics of the components, indexed by their
+     * labels. The entry 0 describes the background points (its
+     * bounding box is meaningless when there are none).
+     */
+    const std::vector<ComponentStatistics> & statistics() const;
+
+    /**
+     * @param aLabel a label between 0 and numberOfComponents().
+     * @return the statistics of the component labeled @a aLabel.
+     */
+    const ComponentStatistics & statistics( Label aLabel ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// A neighbor of a point visited before it by the scan.
+    struct Neighbor
+    {
+      /// Displacement to the neighbor.
+      Vector shift;
+      /// Difference of the linearized indices (positive, to subtract).
+      Index offset;
+    };
+
+    /// The labeled image.
+    CountedConstPtrOrConstPtr<Image> myImage;
+    /// Maximal 1-norm of the adjacency.
+    Dimension myMaxNorm1;
+    /// Background value.
+    Value myBackground;
+    /// Image of labels.
+    LabelImage myLabels;
+    /// Statistics indexed by the labels.
+    std::vector<ComponentStatistics> myStatistics;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @return the neighbors of a point which precede it in the
+     * storage order, for the current adjacency.
+     */
+    std::vector<Neighbor> precedingNeighbors() const;
+
+    /**
+     * First pass on the points whose last coordinate (relative to the
+     * lower bound of the domain) lies in [first,last), ignoring the
+     * neighbors outside this slab.
+     *
+     * @param neighbors the preceding neighbors.
+     * @param parents the union-find forest.
+     * @param first the first layer of the slab.
+     * @param last the layer after the slab.
+     */
+    void scanSlab( const std::vector<Neighbor> & neighbors,
+                   std::vector<Index> & parents,
+                   Index first, Index last ) const;
+
+    /**
+     * Merges the trees of the points of layer @a layer with those of
+     * their neighbors in the previous layer.
+     *
+     * @param neighbors the preceding neighbors.
+     * @param parents the union-find forest.
+     * @param layer a layer (relative last coordinate) greater than 0.
+     */
+    void mergeLayer( const std::vector<Neighbor> & neighbors,
+                     std::vector<Index> & parents,
+                     Index layer ) const;
+
+    /**
+     * Second pass: computes the labels and the statistics from the
+     * union-find forest.
+     *
+     * @param parents the union-find forest.
+     */
+    void computeLabels( const std::vector<Index> & parents );
+
+    /**
+     * @param parents the union-find forest.
+     * @param i an index.
+     * @return the root of the tree of @a i (with path halving).
+     */
+    static Index findRoot( std::vector<Index> & parents, Index i );
+
+    /**
+     * Merges the trees of @a i and @a j, the smallest root becoming
+     * the root of the union.
+     *
+     * @param parents the union-find forest.
+     * @param i an index.
+     * @param j an index.
+     */
+    static void unite( std::vector<Index> & parents, Index i, Index j );
+
+    /**
+     * Moves @a p to the next point of the box [lower,upper] in the
+     * storage order (first coordinate first).
+     *
+     * @param p any point of the box.
+     * @param lower the lower bound of the box.
+     * @param upper the upper bound of the box.
+     */
+    static void increment( Point & p, const Point & lower, const Point & upper );
+
+  }; // end of class ConnectedComponentLabeling
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ConnectedComponentLabeling'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ConnectedComponentLabeling' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ConnectedComponentLabeling<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConnectedComponentLabeling.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConnectedComponentLabeling_h
+
+#undef ConnectedComponentLabeling_RECURSES
+#endif // else defined(ConnectedComponentLabeling_RECURSES)
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMortonVector.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module ImageContainerByMortonVector.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMortonVector_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMortonVector.h
+#else // defined(ImageContainerByMortonVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMortonVector_RECURSES
+
+#if !defined ImageContainerByMortonVector_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMortonVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByMortonVector
+  /**
+   * Description of class 'ImageContainerByMortonVector' <p>
+   *
+   * Aim: Model of CImage implementing the association Point<->Value
+   * using a STL vector whose layout follows the Z-order (Morton
+   * order) of the domain points, see Linearizer<HyperRectDomain,
+   * MortonStorage>.
+   *
+   * Contrary to ImageContainerBySTLVector, whose row-major layout
+   * puts the neighbors along the last dimension far away in memory,
+   * the Z-order layout keeps small neighborhoods of a point in the
+   * same cache lines and pages along every dimension. It is therefore
+   * well suited to neighborhood based algorithms on 3D volumes,
+   * especially when the domain is traversed with
+   * HyperRectDomain::mortonRange().
+   *
+   * Point linearization is done through per-dimension tables of
+   * dilated coordinates (the Morton codes of the points lying on each
+   * axis), so that the index of a point is only the sum of
+   * Domain::dimension table entries.
+   *
+   * @note The Z-order is not dense for extents that are not equal
+   * powers of two: the underlying vector has size
+   * Linearizer<Domain,MortonStorage>::getSize(domain), which is at
+   * most 2^dimension times the domain size for cubic domains.
+   *
+   * The value range returned by range() and constRange() follows the
+   * (lexicographic) domain order, as for any other image container.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue at least a model of CLabel.
+   *
+   * @see testImageContainerByMortonVector.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMortonVector
+  {
+  public:
+
+    typedef ImageContainerByMortonVector<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::Space::dimension );
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT ( ( boost::is_same< Domain,
+                            HyperRectDomain< typename Domain::Space > >::value ) );
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Linearizer used to index the points
+    typedef Linearizer<Domain, MortonStorage> MortonLinearizer;
+
+    /// Index type of the underlying container
+    typedef std::size_t Index;
+
+    /////////////////// Data members //////////////////
+  private:
+
+    ///Image domain
+    Domain myDomain;
+
+    ///Domain extent
+    Vector myExtent;
+
+    ///Image values, stored in Z-order
+    std::vector<Value> myValues;
+
+    ///Morton codes of the coordinates along each dimension
+    std::array< std::vector<Index>, dimension > myDilatedCoordinates;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a Domain
+     *
+     * @param aDomain the image domain.
+     * @param aValue the initial value of all the domain points.
+     */
+    ImageContainerByMortonVector ( const Domain &aDomain, const Value &aValue = Value() );
+
+    /**
+     * Copy constructor
+     *
+     * @param other the object to copy.
+     */
+    ImageContainerByMortonVector ( const ImageContainerByMortonVector & other ) = default;
+
+    /**
+     * Assignment operator
+     *
+     * @param other the object to copy.
+     * @return a reference on *this
+     */
+    ImageContainerByMortonVector& operator= ( const ImageContainerByMortonVector & other ) = default;
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByMortonVector() = default;
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator() ( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue ( const Point &aPoint, const Value &aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * Translate the underlying domain by @a aShift
+     * @param aShift any vector
+     */
+    void translateDomain ( const Vector& aShift );
+
+    /**
+     * @return the range providing constant iterators on the values of
+     * the image (in domain order).
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing iterators and output iterators on
+     * the values of the image (in domain order).
+     */
+    Range range();
+
+    /**
+     * @return an output iterator writing the values in domain order.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * Linearizes a point and returns its position in the underlying
+     * Z-ordered vector.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point to convert to an index
+     * @return the index of @a aPoint in the container
+     */
+    Index linearized ( const Point &aPoint ) const;
+
+    /**
+     * @return the size of the underlying Z-ordered vector (greater
+     * than or equal to the domain size).
+     */
+    Index storageSize() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+  }; // end of class ImageContainerByMortonVector
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMortonVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMortonVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageContainerByMortonVector<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerByMortonVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMortonVector_h
+
+#undef ImageContainerByMortonVector_RECURSES
+#endif // else defined(ImageContainerByMortonVector_RECURSES)
@@ -112,6 +112,16 @@ namespace DGtal
      */
     HashKey keyFromCoordinates(const std::size_t treeDepth, const Point & coordinates) const;
 
+    /**
+     * De-interleave the bits of a Morton code (inverse of
+     * interleaveBits). Contrary to coordinatesFromKey, the key is not
+     * expected to have a tree depth prefix.
+     *
+     * @param key the interleaved binary word.
+     * @param coordinates Will contain the resulting coordinates.
+     */
+    void deinterleaveBits(const HashKey key, Point & coordinates) const;
+
     /**
      * Computes the coordinates correspponding to a key.
      *
@@ -513,6 +513,166 @@ namespace DGtal
   template <typename Enable> const DGtal::BigInteger NumberTraitsImpl<DGtal::BigInteger, Enable>::ONE  = 1;
 #endif
 
+#ifdef WITH_INT128
+  namespace details
+  {
+    /**
+     * NumberTraits common part for the 128-bit integer types. They
+     * are compiler extensions, for which std::numeric_limits and
+     * std::is_integral are only specialized in GNU mode, hence the
+     * traits are given explicitly.
+     *
+     * @tparam T        the 128-bit integer type.
+     * @tparam TSigned  its signed version.
+     * @tparam TUnsigned its unsigned version.
+     * @tparam TIsSigned 'true' iff T is signed.
+     */
+    template <typename T, typename TSigned, typename TUnsigned, bool TIsSigned>
+    struct NumberTraitsImplInt128
+    {
+      // ----------------------- Associated types ------------------------------
+      using IsBounded     = TagTrue;  ///< Is the number bounded.
+      using IsUnsigned    = typename BoolToTag<!TIsSigned>::type; ///< Is the number unsigned.
+      using IsSigned      = typename BoolToTag<TIsSigned>::type;  ///< Is the number signed.
+      using IsIntegral    = TagTrue;  ///< Is the number of integral type.
+      using IsSpecialized = TagTrue;  ///< Is that a number type with specific traits.
+
+      using SignedVersion   = TSigned;   ///< Alias to the signed version of the number type.
+      using UnsignedVersion = TUnsigned; ///< Alias to the unsigned version of the number type.
+      using ReturnType      = T;         ///< Alias to the type that should be used as return type.
+
+      /** @brief Defines a type that represents the "best" way to pass
+       *  a parameter of type T to a function.
+       */
+      using ParamType   = typename boost::call_traits<T>::param_type;
+
+      /// Constant Zero.
+      static constexpr T ZERO = T(0);
+
+      /// Constant One.
+      static constexpr T ONE  = T(1);
+
+      /// Return the zero of this integer.
+      static inline constexpr
+      ReturnType zero() noexcept
+      {
+        return ZERO;
+      }
+
+      /// Return the one of this integer.
+      static inline constexpr
+      ReturnType one() noexcept
+      {
+        return ONE;
+      }
+
+      /// Return the minimum possible value for this type of number.
+      static inline constexpr
+      ReturnType min() noexcept
+      {
+        return TIsSigned ? static_cast<T>( -max() - ONE ) : ZERO;
+      }
+
+      /// Return the maximum possible value for this type of number.
+      static inline constexpr
+      ReturnType max() noexcept
+      {
+        return TIsSigned ? static_cast<T>( ~TUnsigned(0) >> 1 ) : static_cast<T>( ~TUnsigned(0) );
+      }
+
+      /// Return the number of significant binary digits for this type of number.
+      static inline constexpr
+      unsigned int digits() noexcept
+      {
+        return TIsSigned ? 127 : 128;
+      }
+
+      /** @brief Return the bounding type of the number.
+       *
+       * @return BOUNDED.
+       */
+      static inline constexpr
+      BoundEnum isBounded() noexcept
+      {
+        return BOUNDED;
+      }
+
+      /** @brief Return the sign type of the number.
+       *
+       * @return SIGNED or UNSIGNED.
+       */
+      static inline constexpr
+      SignEnum isSigned() noexcept
+      {
+        return TIsSigned ? SIGNED : UNSIGNED;
+      }
+
+      /** @brief
+       * Cast method to DGtal::int64_t (for I/O or board export uses
+       * only).
+       */
+      static inline constexpr
+      DGtal::int64_t castToInt64_t(const T & aT) noexcept
+      {
+        return static_cast<DGtal::int64_t>(aT);
+      }
+
+      /** @brief
+       * Cast method to double (for I/O or board export uses
+       * only).
+       */
+      static inline constexpr
+      double castToDouble(const T & aT) noexcept
+      {
+        return static_cast<double>(aT);
+      }
+
+      /** @brief Check the parity of a number.
+       *
+       * @param aT any number.
+       * @return 'true' iff the number is even.
+       */
+      static inline constexpr
+      bool even( ParamType aT ) noexcept
+      {
+        return ( aT & ONE ) == ZERO;
+      }
+
+      /** @brief Check the parity of a number.
+       *
+       * @param aT any number.
+       * @return 'true' iff the number is odd.
+       */
+      static inline constexpr
+      bool odd( ParamType aT ) noexcept
+      {
+        return ( aT & ONE ) != ZERO;
+      }
+    };
+
+    // Definition of the static attributes in order to allow ODR-usage.
+    template <typename T, typename TSigned, typename TUnsigned, bool TIsSigned>
+    constexpr T NumberTraitsImplInt128<T, TSigned, TUnsigned, TIsSigned>::ZERO;
+    template <typename T, typename TSigned, typename TUnsigned, bool TIsSigned>
+    constexpr T NumberTraitsImplInt128<T, TSigned, TUnsigned, TIsSigned>::ONE;
+
+  } // namespace details
+
+  /// Specialization of NumberTraitsImpl for DGtal::int128_t.
+  template <>
+  struct NumberTraitsImpl<DGtal::int128_t, void>
+    : details::NumberTraitsImplInt128<DGtal::int128_t, DGtal::int128_t, DGtal::uint128_t, true>
+  {
+  };
+
+  /// Specialization of NumberTraitsImpl for DGtal::uint128_t.
+  template <>
+  struct NumberTraitsImpl<DGtal::uint128_t, void>
+    : details::NumberTraitsImplInt128<DGtal::uint128_t, DGtal::int128_t, DGtal::uint128_t, false>
+  {
+  };
+#endif
+
   /**
    * Description of template class 'NumberTraits' <p>
    * \brief Aim: The traits class for all models of Cinteger.
@@ -547,6 +707,14 @@ namespace DGtal
     typedef int64_t promote_t;
   };
 
+#ifdef WITH_INT128
+  template<>
+  struct promote_trait<int64_t, int128_t>
+  {
+    typedef int128_t promote_t;
+  };
+#endif
+
 } // namespace DGtal
 
 #endif // !defined NumberTraits_h
@@ -0,0 +1,195 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PaddedArray.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PaddedArray.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PaddedArray_RECURSES)
+#error Recursive header files inclusion detected in PaddedArray.h
+#else // defined(PaddedArray_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PaddedArray_RECURSES
+
+#if !defined PaddedArray_h
+/** Prevents repeated inclusion of headers. */
+#define PaddedArray_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * @brief Aim: computes at compile time the padded size and the
+   * alignment of a PaddedArray.
+   *
+   * The padded size is the smallest power of two greater than or
+   * equal to N, so that a 3D point is stored as 4 components. The
+   * alignment is the byte size of the padded storage, bounded by the
+   * alignment that default allocators guarantee, so that
+   * PaddedArray may be stored in standard containers.
+   *
+   * @tparam T the component type.
+   * @tparam N the number of components.
+   */
+  template < typename T, DGtal::Dimension N >
+  struct PaddedArrayTraits
+  {
+    /// Smallest power of two greater than or equal to M.
+    template < std::size_t M, std::size_t P = 1, bool Done = ( P >= M ) >
+    struct NextPowerOfTwo { static const std::size_t value = NextPowerOfTwo< M, 2*P >::value; };
+    template < std::size_t M, std::size_t P >
+    struct NextPowerOfTwo< M, P, true > { static const std::size_t value = P; };
+
+    /// Number of stored components (including padding).
+    static const std::size_t paddedSize = NextPowerOfTwo< N >::value;
+    /// Maximal alignment guaranteed by default allocators.
+    static const std::size_t maxAlignment = alignof( std::max_align_t );
+    /// Alignment of the storage.
+    static const std::size_t alignment =
+      ( paddedSize * sizeof( T ) < maxAlignment ) ? paddedSize * sizeof( T ) : maxAlignment;
+  };
+
+  template < typename T, DGtal::Dimension N >
+  const std::size_t PaddedArrayTraits<T, N>::paddedSize;
+  template < typename T, DGtal::Dimension N >
+  const std::size_t PaddedArrayTraits<T, N>::maxAlignment;
+  template < typename T, DGtal::Dimension N >
+  const std::size_t PaddedArrayTraits<T, N>::alignment;
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PaddedArray
+  /**
+   * Description of template class 'PaddedArray' <p>
+   * \brief Aim: A fixed-size array of N components, stored in an
+   * aligned buffer padded with zeros up to a power of two.
+   *
+   * PaddedArray is a drop-in replacement of std::array for the
+   * container template parameter of PointVector. Since the whole
+   * padded buffer is aligned and its padding components are always
+   * zero, the component-wise operations of PointVector (sums,
+   * differences, infimum, supremum, dot product) are specialized for
+   * this storage in order to process the full padded buffer at once,
+   * which compilers turn into a few SIMD instructions for 2D, 3D and
+   * 4D points with @c int32_t, @c int64_t, @c float or @c double
+   * components.
+   *
+   * As a container, it only exposes the N first components: size(),
+   * begin() and end() behave as for std::array<T,N>.
+   *
+   * @code
+   * typedef PointVector< 3, double, PaddedArray<double, 3> > AlignedRealPoint;
+   * AlignedRealPoint p( 1.0, 2.0, 3.0 ), q( 0.5, 0.5, 0.5 );
+   * AlignedRealPoint r = p + q; // 2 or 1 SIMD additions.
+   * @endcode
+   *
+   * @tparam T the component type.
+   * @tparam N the number of components.
+   *
+   * @see PointVector
+   * @see testPointVector.cpp
+   */
+  template < typename T, DGtal::Dimension N >
+  class PaddedArray
+  {
+  public:
+    typedef PaddedArrayTraits< T, N > Traits;
+    typedef T value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    /// Number of stored components, including padding.
+    static const std::size_t paddedSize = Traits::paddedSize;
+
+    /// Default constructor. All components (and padding) are zero.
+    PaddedArray()
+    {
+      std::fill( myData, myData + paddedSize, T() );
+    }
+
+    /// @return the number of components (padding excluded).
+    static constexpr size_type size() { return N; }
+    /// @return the number of components (padding excluded).
+    static constexpr size_type max_size() { return N; }
+    /// @return true iff the array has no component.
+    static constexpr bool empty() { return N == 0; }
+
+    /// @param i an index in [0,N[.
+    /// @return a reference on the i-th component.
+    reference operator[]( size_type i ) { return myData[ i ]; }
+    /// @param i an index in [0,N[.
+    /// @return a const reference on the i-th component.
+    const_reference operator[]( size_type i ) const { return myData[ i ]; }
+
+    /// @return a pointer on the padded aligned buffer.
+    pointer data() { return myData; }
+    /// @return a const pointer on the padded aligned buffer.
+    const_pointer data() const { return myData; }
+
+    /// @param value the value given to the N components (padding stays zero).
+    void fill( const T& value ) { std::fill( myData, myData + N, value ); }
+
+    iterator begin() { return myData; }
+    iterator end() { return myData + N; }
+    const_iterator begin() const { return myData; }
+    const_iterator end() const { return myData + N; }
+    const_iterator cbegin() const { return myData; }
+    const_iterator cend() const { return myData + N; }
+    reverse_iterator rbegin() { return reverse_iterator( end() ); }
+    reverse_iterator rend() { return reverse_iterator( begin() ); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator( end() ); }
+    const_reverse_iterator rend() const { return const_reverse_iterator( begin() ); }
+
+  private:
+    /// The aligned padded buffer.
+    alignas( Traits::alignment ) T myData[ Traits::paddedSize ];
+  };
+
+  template < typename T, DGtal::Dimension N >
+  const std::size_t PaddedArray<T, N>::paddedSize;
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PaddedArray_h
+
+#undef PaddedArray_RECURSES
+#endif // else defined(PaddedArray_RECURSES)
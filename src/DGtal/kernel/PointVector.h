@@ -56,6 +56,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CBidirectionalRange.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/PaddedArray.h"
 #include "DGtal/kernel/CEuclideanRing.h"
 #include "DGtal/kernel/ArithmeticConversionTraits.h"
 
@@ -584,6 +585,60 @@ namespace DGtal
   isUpper( PointVector<ptDim, LeftEuclideanRing, LeftContainer> const& lhs,
            PointVector<ptDim, RightEuclideanRing, RightContainer> const& rhs );
 
+  /////////////////////////////////////////////////////////////////////////////
+  // Specializations for the aligned padded storage PaddedArray.
+  // They process the whole padded buffer so that compilers emit SIMD code.
+
+  /** @brief Addition operator between two Points/Vectors stored in PaddedArray.
+   *
+   * @return the component-wise sum of @a lhs and @a rhs.
+   * @see PaddedArray
+   */
+  template < Dimension ptDim, typename TEuclideanRing >
+  inline PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> >
+  operator+ ( PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& lhs,
+              PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& rhs );
+
+  /** @brief Subtraction operator between two Points/Vectors stored in PaddedArray.
+   *
+   * @return the component-wise difference of @a lhs and @a rhs.
+   * @see PaddedArray
+   */
+  template < Dimension ptDim, typename TEuclideanRing >
+  inline PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> >
+  operator- ( PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& lhs,
+              PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& rhs );
+
+  /** @brief Dot product between two Points/Vectors stored in PaddedArray.
+   *
+   * @return the dot product of @a lhs and @a rhs.
+   * @see PaddedArray
+   */
+  template < Dimension ptDim, typename TEuclideanRing >
+  inline TEuclideanRing
+  dotProduct ( PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& lhs,
+               PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& rhs );
+
+  /** @brief Infimum of two Points/Vectors stored in PaddedArray.
+   *
+   * @return the component-wise minimum of @a lhs and @a rhs.
+   * @see PaddedArray
+   */
+  template < Dimension ptDim, typename TEuclideanRing >
+  inline PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> >
+  inf( PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& lhs,
+       PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& rhs );
+
+  /** @brief Supremum of two Points/Vectors stored in PaddedArray.
+   *
+   * @return the component-wise maximum of @a lhs and @a rhs.
+   * @see PaddedArray
+   */
+  template < Dimension ptDim, typename TEuclideanRing >
+  inline PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> >
+  sup( PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& lhs,
+       PointVector<ptDim, TEuclideanRing, PaddedArray<TEuclideanRing, ptDim> > const& rhs );
+
   /////////////////////////////////////////////////////////////////////////////
   // class PointVector full declaration
   template < DGtal::Dimension dim,
@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PointVectorSoA.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module PointVectorSoA.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PointVectorSoA_RECURSES)
+#error Recursive header files inclusion detected in PointVectorSoA.h
+#else // defined(PointVectorSoA_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PointVectorSoA_RECURSES
+
+#if !defined PointVectorSoA_h
+/** Prevents repeated inclusion of headers. */
+#define PointVectorSoA_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <array>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointVectorSoA
+  /**
+   * Description of template class 'PointVectorSoA' <p>
+   * \brief Aim: A buffer of points stored as a structure of arrays,
+   * i.e. one contiguous array of coordinates per dimension.
+   *
+   * Contrary to a std::vector<Point>, which interleaves the
+   * coordinates of each point, this layout lets batched operations
+   * (translation, bounding box, dot products, squared distances,
+   * binning) process each dimension with unit-stride loops that
+   * compilers vectorize across points.
+   *
+   * Points are read back with point(i) and written with push_back()
+   * and setPoint(); the coordinate arrays are directly accessible
+   * through coordinates() and data().
+   *
+   * @code
+   * PointVectorSoA< Z3i::RealPoint > buffer( points.begin(), points.end() );
+   * Z3i::RealPoint lo, up;
+   * buffer.boundingBox( lo, up );
+   * std::vector<double> d2;
+   * buffer.squaredDistances( Z3i::RealPoint( 1.0, 2.0, 3.0 ), d2 );
+   * @endcode
+   *
+   * @tparam TPoint any PointVector type.
+   *
+   * @see SpatialCubicalSubdivision
+   */
+  template < typename TPoint >
+  class PointVectorSoA
+  {
+  public:
+    typedef PointVectorSoA<TPoint> Self;
+    typedef TPoint Point;
+    typedef typename Point::Component Component;
+    typedef typename Point::Dimension Dimension;
+    typedef std::size_t Size;
+    typedef std::vector<Component> Coordinates;
+
+    BOOST_STATIC_CONSTANT( Dimension, dimension = Point::dimension );
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /// Default constructor. The buffer is empty.
+    PointVectorSoA() = default;
+
+    /**
+     * Constructor from a range of points.
+     * @tparam PointIterator a model of input iterator on points.
+     * @param itb begin iterator on the points.
+     * @param ite end iterator on the points.
+     */
+    template < typename PointIterator >
+    PointVectorSoA( PointIterator itb, PointIterator ite );
+
+    // ----------------------- Container services -----------------------------
+  public:
+
+    /// @return the number of points in the buffer.
+    Size size() const;
+
+    /// @return 'true' iff the buffer has no point.
+    bool empty() const;
+
+    /// Removes all the points.
+    void clear();
+
+    /// @param n the number of points to reserve memory for.
+    void reserve( Size n );
+
+    /// @param n the new number of points (new points are at the origin).
+    void resize( Size n );
+
+    /// @param p the point to append to the buffer.
+    void push_back( const Point& p );
+
+    /**
+     * Appends a range of points.
+     * @tparam PointIterator a model of input iterator on points.
+     * @param itb begin iterator on the points.
+     * @param ite end iterator on the points.
+     */
+    template < typename PointIterator >
+    void append( PointIterator itb, PointIterator ite );
+
+    /// @param i an index in [0,size()[.
+    /// @return the i-th point.
+    Point point( Size i ) const;
+
+    /// @param i an index in [0,size()[.
+    /// @param p the new value of the i-th point.
+    void setPoint( Size i, const Point& p );
+
+    /// @param k a dimension.
+    /// @return the array of the k-th coordinates of the points.
+    const Coordinates& coordinates( Dimension k ) const;
+
+    /// @param k a dimension.
+    /// @return a pointer on the k-th coordinates of the points.
+    Component* data( Dimension k );
+
+    /// @param k a dimension.
+    /// @return a const pointer on the k-th coordinates of the points.
+    const Component* data( Dimension k ) const;
+
+    /// @param[out] pts the vector where the points are appended.
+    void copyTo( std::vector<Point> & pts ) const;
+
+    // ----------------------- Batched operations -----------------------------
+  public:
+
+    /// Translates all the points.
+    /// @param v the translation vector.
+    void translate( const Point& v );
+
+    /**
+     * Computes the bounding box of the points, i.e. the infimum and
+     * supremum of all the points.
+     *
+     * @pre the buffer is not empty.
+     * @param[out] lower the infimum of the points.
+     * @param[out] upper the supremum of the points.
+     */
+    void boundingBox( Point& lower, Point& upper ) const;
+
+    /**
+     * Computes the dot product of every point with a given vector.
+     *
+     * @tparam TScalar the scalar type of the results.
+     * @param v any vector.
+     * @param[out] result the size() dot products.
+     */
+    template < typename TScalar >
+    void dotProducts( const Point& v, std::vector<TScalar> & result ) const;
+
+    /**
+     * Computes the squared Euclidean distance of every point to a given point.
+     *
+     * @tparam TScalar the scalar type of the results.
+     * @param p any point.
+     * @param[out] result the size() squared distances.
+     */
+    template < typename TScalar >
+    void squaredDistances( const Point& p, std::vector<TScalar> & result ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The coordinates of the points, one array per dimension.
+    std::array< Coordinates, dimension > myCoordinates;
+
+  }; // end of class PointVectorSoA
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PointVectorSoA'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PointVectorSoA' to write.
+   * @return the output stream after the writing.
+   */
+  template < typename TPoint >
+  std::ostream&
+  operator<< ( std::ostream & out, const PointVectorSoA<TPoint> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/PointVectorSoA.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PointVectorSoA_h
+
+#undef PointVectorSoA_RECURSES
+#endif // else defined(PointVectorSoA_RECURSES)
@@ -0,0 +1,286 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+/**
+ * @file ShardedUnorderedSetByBlock.h
+ *
+ * @date 2026/10/19
+ *
+ */
+#ifndef SHARDEDUNORDEREDSETBYBLOCK_HPP
+#define SHARDEDUNORDEREDSETBYBLOCK_HPP
+
+#include <vector>
+#include <mutex>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/UnorderedSetByBlock.h"
+
+namespace DGtal
+{
+
+  /// This data structure is a set of elements (digital points) that
+  /// may be populated concurrently by several threads. It is made of
+  /// several UnorderedSetByBlock, called shards, each one protected
+  /// by its own mutex. A block of elements (see Splitter) always
+  /// belongs to the same shard, which is chosen from the hash value
+  /// of the block. Hence shards are disjoint, threads inserting in
+  /// different shards never wait for each other, and merging the
+  /// shards into a single UnorderedSetByBlock is a plain copy of
+  /// their blocks.
+  ///
+  /// Insertion, lookup and erasure are thread-safe. Bulk insertion
+  /// of ranges gathers consecutive elements of the same block before
+  /// locking its shard. Global services (size, clear, merge) lock all
+  /// the shards in turn and should not be called while other threads
+  /// are modifying the set if an exact snapshot is needed.
+  ///
+  /// @code
+  /// #include "DGtal/kernel/ShardedUnorderedSetByBlock.h"
+  /// ...
+  /// DGtal::ShardedUnorderedSetByBlock< Z3i::Point > shared;
+  /// #pragma omp parallel for schedule(dynamic)
+  /// for ( int z = lo[ 2 ]; z <= up[ 2 ]; ++z )
+  ///   ... shared.insert( p ); // thread-safe
+  /// DGtal::UnorderedSetByBlock< Z3i::Point > result = shared.merge();
+  /// @endcode
+  ///
+  /// @tparam Key the type of integral array.
+  /// @tparam TSplitter the type for splitting a key into a block and a bit (see \ref Splitter).
+  /// @tparam Hash the type that provides a hasher for Key.
+  /// @tparam KeyEqual the type that provides an equality comparator for Key.
+  ///
+  /// @see UnorderedSetByBlock
+  template < typename Key,
+             typename TSplitter = Splitter< Key >,
+             class Hash = std::hash<Key>,
+             class KeyEqual = std::equal_to<Key> >
+  struct ShardedUnorderedSetByBlock {
+    typedef ShardedUnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual > Self;
+    typedef UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual > Shard;
+    typedef TSplitter                    Splitter;
+    typedef typename Splitter::Word      Word;
+    typedef Key                          key_type;
+    typedef Key                          value_type;
+    typedef typename Shard::size_type    size_type;
+
+    // ---------------------- Standard services ------------------------------
+    /// @name Standard services (construction, initialization, assignment)
+    /// @{
+  public:
+
+    /// Main constructor.
+    /// @param nb_shards the number of shards, which should be
+    /// significantly greater than the number of threads.
+    explicit ShardedUnorderedSetByBlock( size_type nb_shards = 64 )
+      : my_slots( nb_shards == 0 ? 1 : nb_shards )
+    {}
+
+    /// Copy is forbidden (shards are protected by mutexes).
+    ShardedUnorderedSetByBlock( const Self& other ) = delete;
+    /// Assignment is forbidden (shards are protected by mutexes).
+    Self& operator=( const Self& other ) = delete;
+
+    /// @}
+
+    // ---------------------- modifier services -----------------------------
+    /// @name Modifier services (thread-safe)
+    /// @{
+  public:
+
+    /// Inserts an element (thread-safe).
+    /// @param value the element to insert.
+    /// @return 'true' iff the element was not already in the set.
+    bool insert( const value_type& value )
+    {
+      const auto se = Splitter::split( value );
+      Slot & slot   = my_slots[ shard_index( se.first ) ];
+      std::lock_guard< std::mutex > guard( slot.mutex );
+      return slot.set.insert_block( se.first,
+                                    static_cast<Word>(1) << se.second ) != 0;
+    }
+
+    /// Inserts the elements of the range [first,last)
+    /// (thread-safe). Consecutive elements lying in the same block are
+    /// inserted with a single lock of their shard.
+    ///
+    /// @tparam InputIt a model of input iterator on elements.
+    /// @param first the beginning of the range.
+    /// @param last the end of the range.
+    template< class InputIt >
+    void insert( InputIt first, InputIt last )
+    {
+      if ( first == last ) return;
+      const KeyEqual equal;
+      auto se    = Splitter::split( *first );
+      Key  block = se.first;
+      Word word  = static_cast<Word>(1) << se.second;
+      for ( ++first; first != last; ++first )
+        {
+          se = Splitter::split( *first );
+          if ( ! equal( se.first, block ) )
+            {
+              insert_block( block, word );
+              block = se.first;
+              word  = static_cast<Word>(0);
+            }
+          word |= static_cast<Word>(1) << se.second;
+        }
+      insert_block( block, word );
+    }
+
+    /// Inserts all the elements of a block at once (thread-safe).
+    /// @param block the block coordinates (see Splitter::split).
+    /// @param word the bits of the elements of the block to insert.
+    /// @return the number of elements actually inserted.
+    size_type insert_block( const Key& block, Word word )
+    {
+      Slot & slot = my_slots[ shard_index( block ) ];
+      std::lock_guard< std::mutex > guard( slot.mutex );
+      return slot.set.insert_block( block, word );
+    }
+
+    /// Removes an element (thread-safe).
+    /// @param key the element to remove.
+    /// @return the number of removed elements (0 or 1).
+    size_type erase( const key_type& key )
+    {
+      Slot & slot = my_slots[ shard_index( Splitter::split( key ).first ) ];
+      std::lock_guard< std::mutex > guard( slot.mutex );
+      return slot.set.erase( key );
+    }
+
+    /// Clears the set.
+    void clear()
+    {
+      for ( auto & slot : my_slots )
+        {
+          std::lock_guard< std::mutex > guard( slot.mutex );
+          slot.set.clear();
+        }
+    }
+
+    /// @}
+
+    // ---------------------- lookup services -----------------------------
+    /// @name Lookup services
+    /// @{
+  public:
+
+    /// @param key the value to look-up.
+    /// @return 1 if \a key is in the set, 0 otherwise (thread-safe).
+    size_type count( const Key& key ) const
+    {
+      const Slot & slot = my_slots[ shard_index( Splitter::split( key ).first ) ];
+      std::lock_guard< std::mutex > guard( slot.mutex );
+      return slot.set.count( key );
+    }
+
+    /// @return the number of elements in the set.
+    size_type size() const
+    {
+      size_type nb = 0;
+      for ( const auto & slot : my_slots )
+        {
+          std::lock_guard< std::mutex > guard( slot.mutex );
+          nb += slot.set.size();
+        }
+      return nb;
+    }
+
+    /// @return 'true' iff the set is empty.
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    /// @return the number of shards.
+    size_type shards() const
+    {
+      return my_slots.size();
+    }
+
+    /// @param i any index in 0..shards()-1.
+    /// @return a const reference to the \a i-th shard.
+    /// @note Not protected against concurrent modifications.
+    const Shard& shard( size_type i ) const
+    {
+      return my_slots[ i ].set;
+    }
+
+    /// @}
+
+    // ---------------------- conversion services -----------------------------
+    /// @name Conversion services
+    /// @{
+  public:
+
+    /// Adds all the elements of this set to \a result. Since shards
+    /// are disjoint, blocks are copied without any merging.
+    ///
+    /// @param[in,out] result any unordered set by block.
+    void merge_into( Shard& result ) const
+    {
+      size_type nb_blocks = result.blocks();
+      for ( const auto & slot : my_slots )
+        nb_blocks += slot.set.blocks();
+      result.reserve( nb_blocks );
+      for ( const auto & slot : my_slots )
+        {
+          std::lock_guard< std::mutex > guard( slot.mutex );
+          result.assign_union( slot.set );
+        }
+    }
+
+    /// @return an unordered set by block containing all the elements
+    /// of this set.
+    Shard merge() const
+    {
+      Shard result;
+      merge_into( result );
+      return result;
+    }
+
+    /// @}
+
+  private:
+    /// A shard and its mutex.
+    struct Slot {
+      /// the mutex protecting the shard.
+      mutable std::mutex mutex;
+      /// the shard.
+      Shard set;
+    };
+
+    /// @param block any block coordinates.
+    /// @return the index of the shard storing \a block.
+    size_type shard_index( const Key& block ) const
+    {
+      // The hash value is mixed so that the shard index and the bucket
+      // index within the shard depend on different bits.
+      const DGtal::uint64_t h = static_cast<DGtal::uint64_t>( Hash()( block ) );
+      return static_cast<size_type>( ( h * 0x9E3779B97F4A7C15ULL ) >> 32 )
+        % my_slots.size();
+    }
+
+    // -------------------------- data ---------------------------------
+    /// the shards with their mutex.
+    std::vector< Slot > my_slots;
+  };
+
+} // namespace DGtal
+
+#endif // #ifndef SHARDEDUNORDEREDSETBYBLOCK_HPP
@@ -35,6 +35,8 @@
 #include "DGtal/kernel/CBoundedNumber.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/PointHashFunctions.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/SetFunctions.h"
 
 namespace DGtal
 {
@@ -134,6 +136,11 @@ namespace DGtal
   /// queries/insertion/erase.
   ///
   /// Almost all standard operations of unordered_set in c++11 are implemented.
+  /// Bulk insertion of ranges and set operations (union,
+  /// intersection, differences, inclusion) proceed block by block,
+  /// and the set operations of SetFunctions.h use them. See
+  /// ShardedUnorderedSetByBlock for concurrent population by several
+  /// threads.
   ///
   /// @tparam Key the type of integral array.
   /// @tparam TSplitter the type for splitting a key into a block and a bit (see \ref Splitter).
@@ -716,6 +723,56 @@ namespace DGtal
         }
     }
 
+    /// Inserts the elements of the range [first,last). Consecutive
+    /// elements lying in the same block (e.g. points sorted along the
+    /// x-axis, as given by a domain scan) are gathered into one word
+    /// before a single lookup in the container, so that a sorted range
+    /// costs one hash lookup per block instead of one per element.
+    /// Unsorted ranges are handled correctly as well.
+    ///
+    /// @tparam InputIt a model of input iterator on elements.
+    /// @param first the beginning of the range.
+    /// @param last the end of the range.
+    template< class InputIt >
+    void insert( InputIt first, InputIt last )
+    {
+      if ( first == last ) return;
+      auto se    = my_splitter.split( *first );
+      Key  block = se.first;
+      Word word  = static_cast<Word>(1) << se.second;
+      for ( ++first; first != last; ++first )
+        {
+          se = my_splitter.split( *first );
+          if ( ! my_elements.key_eq()( se.first, block ) )
+            {
+              insert_block( block, word );
+              block = se.first;
+              word  = static_cast<Word>(0);
+            }
+          word |= static_cast<Word>(1) << se.second;
+        }
+      insert_block( block, word );
+    }
+
+    /// Inserts all the elements of a block at once.
+    ///
+    /// @note Specific to this data structure.
+    ///
+    /// @param block the block coordinates (i.e. an element as given by
+    /// Splitter::split).
+    /// @param word the bits of the elements of the block to insert.
+    /// @return the number of elements actually inserted.
+    size_type insert_block( const Key& block, Word word )
+    {
+      if ( word == static_cast<Word>(0) ) return 0;
+      auto   p = my_elements.insert( std::make_pair( block, static_cast<Word>(0) ) );
+      Word & w = p.first->second;
+      const size_type nb = Bits::nbSetBits( static_cast<Word>( word & ~w ) );
+      w       |= word;
+      my_size += nb;
+      return nb;
+    }
+
     /// Removes specified element from the container.
     /// @param pos a valid iterator in this data structure
     /// @return the iterator following the last removed element.
@@ -941,6 +998,123 @@ namespace DGtal
       return internal_includes_by_map_iterator( other );
     }
 
+    /// Set union to left, computed block by block: each block of \a
+    /// other is or-ed with the corresponding block of this set.
+    ///
+    /// @param other any unordered set with same sort of elements
+    /// @return a reference to this set.
+    Self& assign_union( const Self& other )
+    {
+      if ( this == &other ) return *this;
+      my_elements.reserve( my_elements.size() + other.my_elements.size() );
+      for ( auto itMap = other.my_elements.cbegin(), itEnd = other.my_elements.cend();
+            itMap != itEnd; ++itMap )
+        insert_block( itMap->first, itMap->second );
+      return *this;
+    }
+
+    /// Set intersection to left, computed block by block: each block
+    /// of this set is and-ed with the corresponding block of \a other.
+    ///
+    /// @param other any unordered set with same sort of elements
+    /// @return a reference to this set.
+    Self& assign_intersection( const Self& other )
+    {
+      if ( this == &other ) return *this;
+      const auto itEnd_other = other.my_elements.cend();
+      for ( auto itMap = my_elements.begin(); itMap != my_elements.end(); )
+        {
+          const auto itMap_other = other.my_elements.find( itMap->first );
+          const Word w = ( itMap_other == itEnd_other )
+            ? static_cast<Word>(0) : itMap->second & itMap_other->second;
+          my_size -= Bits::nbSetBits( static_cast<Word>( itMap->second & ~w ) );
+          if ( w == static_cast<Word>(0) ) itMap = my_elements.erase( itMap );
+          else { itMap->second = w; ++itMap; }
+        }
+      return *this;
+    }
+
+    /// Set difference to left, computed block by block: the bits of
+    /// each block of \a other are cleared in this set.
+    ///
+    /// @param other any unordered set with same sort of elements
+    /// @return a reference to this set.
+    Self& assign_difference( const Self& other )
+    {
+      if ( this == &other ) { clear(); return *this; }
+      for ( auto itMap_other = other.my_elements.cbegin(),
+              itEnd_other = other.my_elements.cend();
+            itMap_other != itEnd_other; ++itMap_other )
+        {
+          const auto itMap = my_elements.find( itMap_other->first );
+          if ( itMap == my_elements.end() ) continue;
+          const Word w = itMap->second & ~itMap_other->second;
+          my_size -= Bits::nbSetBits( static_cast<Word>( itMap->second & itMap_other->second ) );
+          if ( w == static_cast<Word>(0) ) my_elements.erase( itMap );
+          else itMap->second = w;
+        }
+      return *this;
+    }
+
+    /// Symmetric difference to left, computed block by block: the
+    /// bits of each block of \a other are xor-ed with this set.
+    ///
+    /// @param other any unordered set with same sort of elements
+    /// @return a reference to this set.
+    Self& assign_symmetric_difference( const Self& other )
+    {
+      if ( this == &other ) { clear(); return *this; }
+      for ( auto itMap_other = other.my_elements.cbegin(),
+              itEnd_other = other.my_elements.cend();
+            itMap_other != itEnd_other; ++itMap_other )
+        {
+          auto   p = my_elements.insert
+            ( std::make_pair( itMap_other->first, static_cast<Word>(0) ) );
+          Word & w = p.first->second;
+          my_size -= Bits::nbSetBits( w );
+          w       ^= itMap_other->second;
+          my_size += Bits::nbSetBits( w );
+          if ( w == static_cast<Word>(0) ) my_elements.erase( p.first );
+        }
+      return *this;
+    }
+
+    /// @param other any unordered set with same sort of elements
+    /// @return 'true' if and only if this set and \a other have the same
+    /// elements (compared block by block).
+    bool operator==( const Self& other ) const
+    {
+      return my_size == other.my_size && my_elements == other.my_elements;
+    }
+
+    /// @param other any unordered set with same sort of elements
+    /// @return 'true' if and only if this set and \a other have not the same
+    /// elements.
+    bool operator!=( const Self& other ) const
+    {
+      return ! ( *this == other );
+    }
+
+    /// @note Specific to this data structure.
+    /// @return the number of elements, recomputed by counting the
+    /// bits of every block (should always be equal to size()).
+    size_type count_elements() const
+    {
+      size_type nb = 0;
+      for ( auto itMap = my_elements.cbegin(), itEnd = my_elements.cend();
+            itMap != itEnd; ++itMap )
+        nb += Bits::nbSetBits( itMap->second );
+      return nb;
+    }
+
+    /// @note Specific to this data structure.
+    /// @return a const reference to the underlying container mapping
+    /// blocks to words.
+    const Container& blocks_container() const
+    {
+      return my_elements;
+    }
+
   protected:
     /// Performs includes operation using underlying container iterator.
     /// @param other any unordered set with same sort of elements
@@ -1104,6 +1278,56 @@ namespace DGtal
     s1.swap( s2 );
   }
 
+  /// Defines container traits for UnorderedSetByBlock (an unordered
+  /// set of elements).
+  template < typename Key,
+             typename TSplitter,
+             class Hash,
+             class KeyEqual,
+             class UnorderedMapAllocator >
+  struct ContainerTraits
+  < UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual, UnorderedMapAllocator > >
+  {
+    typedef UnorderedSetAssociativeCategory Category;
+  };
+
+  namespace detail {
+
+    /// Specialization of set operations for UnorderedSetByBlock,
+    /// which are computed on blocks instead of elements.
+    template < typename Key,
+               typename TSplitter,
+               class Hash,
+               class KeyEqual,
+               class UnorderedMapAllocator >
+    struct SetFunctionsImpl
+    < UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual, UnorderedMapAllocator >,
+      true, false >
+    {
+      typedef UnorderedSetByBlock< Key, TSplitter, Hash, KeyEqual,
+                                   UnorderedMapAllocator > Container;
+
+      static bool isEqual( const Container& S1, const Container& S2 )
+      { return S1 == S2; }
+
+      static bool isSubset( const Container& S1, const Container& S2 )
+      { return S2.includes( S1 ); }
+
+      static Container& assignDifference( Container& S1, const Container& S2 )
+      { return S1.assign_difference( S2 ); }
+
+      static Container& assignUnion( Container& S1, const Container& S2 )
+      { return S1.assign_union( S2 ); }
+
+      static Container& assignIntersection( Container& S1, const Container& S2 )
+      { return S1.assign_intersection( S2 ); }
+
+      static Container& assignSymmetricDifference( Container& S1, const Container& S2 )
+      { return S1.assign_symmetric_difference( S2 ); }
+    };
+
+  } // namespace detail
+
 } // namespace DGtal
 
 #endif // #ifndef UNORDEREDSETBYBLOCK_HPP
@@ -555,6 +555,62 @@ namespace DGtal
         return ConstSubRange(*this, permutation, startingPoint);
       }
 
+    /**
+     * Description of class 'ConstMortonRange' <p> \brief Aim:
+     * range through the whole domain in Z-order (Morton order).
+     *
+     * Consecutive points of this range are close along every
+     * dimension, which is well suited to neighborhood based
+     * algorithms. The order is the one of the storage indices given by
+     * Linearizer< HyperRectDomain, MortonStorage >.
+     */
+    struct ConstMortonRange
+    {
+      typedef HyperRectDomain_MortonIterator<Point> ConstIterator;
+
+      /**
+       * ConstMortonRange constructor from a given domain.
+       * @param domain a HyperRectDomain.
+       */
+      ConstMortonRange(const HyperRectDomain<TSpace>& domain)
+        : myLowerBound(domain.lowerBound()),
+          myUpperBound(domain.upperBound())
+        {}
+
+      /**
+       * begin method.
+       * @return ConstIterator on the beginning of the range.
+       */
+      ConstIterator begin() const
+        {
+          return ConstIterator(myLowerBound, myUpperBound);
+        }
+
+      /**
+       * end method.
+       * @return ConstIterator on the end of the range.
+       */
+      ConstIterator end() const
+        {
+          return ConstIterator(myLowerBound, myUpperBound, true);
+        }
+
+    private:
+      /// Lower bound of the domain.
+      Point myLowerBound;
+      /// Upper bound of the domain.
+      Point myUpperBound;
+    }; // ConstMortonRange
+
+    /**
+     * get a range scanning the whole domain in Z-order.
+     * @return a Z-order range of the domain.
+     */
+    ConstMortonRange mortonRange() const
+      {
+        return ConstMortonRange(*this);
+      }
+
     // ----------------------- Interface --------------------------------------
   public:
 
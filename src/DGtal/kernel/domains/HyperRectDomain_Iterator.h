@@ -49,6 +49,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 
 #include "DGtal/base/Common.h"
+#include "DGtal/images/Morton.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -498,6 +499,156 @@ namespace DGtal
 
   }; // End of class HyperRectDomain_subIterator
 
+  /////////////////////////////////////////////////////////////////////////////
+  // class HyperRectDomain_MortonIterator
+  /** @brief Iterator scanning a HyperRectDomain in Z-order (Morton order).
+   *
+   * The points are visited by increasing Morton code of their
+   * coordinates relative to the domain lower bound, i.e. in the same
+   * order as the storage indices given by
+   * Linearizer<HyperRectDomain, MortonStorage>. Consecutive points of
+   * this traversal are thus close in every dimension, which improves
+   * the locality of neighborhood based algorithms.
+   *
+   * Codes that fall outside the domain (the Morton order covers a
+   * power-of-two hypercube) are skipped by whole aligned blocks, so
+   * that each increment costs at most a few code decodings.
+   *
+   * @note Each coordinate of a point relative to the lower bound must
+   * fit in 64/dimension bits.
+   *
+   * @tparam TPoint Point type.
+   */
+  template <typename TPoint>
+  class HyperRectDomain_MortonIterator
+    : public boost::iterator_facade <
+        HyperRectDomain_MortonIterator<TPoint>,
+        TPoint const,
+        std::forward_iterator_tag,
+        TPoint const&
+      >
+  {
+  public:
+    using Point = TPoint;
+    using Self  = HyperRectDomain_MortonIterator<TPoint>;
+    using Dimension = typename Point::Dimension;
+    using HashKey = DGtal::uint64_t; ///< Type of the Morton codes.
+
+    /** @brief Z-order iterator constructor
+     *
+     * @param lower Lower bound of the iterated domain
+     * @param upper Upper bound of the iterated domain
+     * @param atEnd if true, the iterator is the past-the-end iterator.
+     */
+    HyperRectDomain_MortonIterator( const Point& lower, const Point &upper, bool atEnd = false )
+      : myPoint( lower ), mylower( lower ), myExtent( upper - lower + Point::diagonal(1) ),
+        myKey( 0 ), myEndKey( 0 )
+      {
+        bool isEmpty = false;
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          isEmpty = isEmpty || myExtent[ i ] <= 0;
+        if ( ! isEmpty )
+          {
+            myMorton.interleaveBits( myExtent - Point::diagonal(1), myEndKey );
+            ++myEndKey;
+          }
+        if ( atEnd )
+          myKey = myEndKey;
+      }
+
+    /// @return the Morton code of the current point relative to the domain lower bound.
+    HashKey key() const
+      {
+        return myKey;
+      }
+
+  private:
+    friend class boost::iterator_core_access;
+
+    /// @brief Dereference
+    const Point& dereference() const
+      {
+        ASSERT_MSG( myKey < myEndKey, "The iterator points outside the domain." );
+        return myPoint;
+      }
+
+    /** @brief Compare iterators
+     *
+     * @note compare only the Morton codes, not the iterated domain.
+     */
+    bool equal( const Self &other ) const
+      {
+        ASSERT_MSG( // we should only compare iterators on the same domain
+            mylower == other.mylower && myExtent == other.myExtent,
+            "The compared iterators iterate on different domains."
+        );
+        return myKey == other.myKey;
+      }
+
+    /** @brief
+     * Increments the iterator to the next domain point in Z-order.
+     *
+     * When the next code lies outside the domain, the largest aligned
+     * block of codes containing it and lying entirely outside the
+     * domain is skipped.
+     */
+    void increment()
+      {
+        Point q;
+        for ( ++myKey; myKey < myEndKey; )
+          {
+            myMorton.deinterleaveBits( myKey, q );
+            unsigned int level = 0;
+            bool inside = true;
+            for ( Dimension i = 0; i < Point::dimension; ++i )
+              {
+                if ( q[ i ] < myExtent[ i ] ) continue;
+                inside = false;
+                unsigned int l = level;
+                while ( l + 1 < bitsPerCoordinate
+                        && ( ( q[ i ] >> ( l + 1 ) ) << ( l + 1 ) ) >= myExtent[ i ] )
+                  ++l;
+                level = l;
+              }
+            if ( inside )
+              {
+                myPoint = mylower + q;
+                return;
+              }
+            // Jumps to the first code after the aligned block of side 2^level.
+            const unsigned int shift = level * Point::dimension;
+            myKey = ( ( myKey >> shift ) + 1 ) << shift;
+          }
+        myKey = myEndKey;
+      }
+
+  private:
+    /// Number of bits of each coordinate in a Morton code.
+    static const unsigned int bitsPerCoordinate =
+      ( ( sizeof( HashKey ) << 3 ) / Point::dimension < ( sizeof( typename Point::Component ) << 3 ) - 1 )
+      ? ( sizeof( HashKey ) << 3 ) / Point::dimension
+      : ( sizeof( typename Point::Component ) << 3 ) - 1;
+
+    ///Current Point in the domain
+    TPoint myPoint;
+
+    ///Copy of the Domain lower bound
+    TPoint mylower;
+
+    ///Domain extent
+    TPoint myExtent;
+
+    ///Morton code of the current point
+    HashKey myKey;
+
+    ///Past-the-end Morton code
+    HashKey myEndKey;
+
+    ///Morton code builder
+    Morton<HashKey, TPoint> myMorton;
+
+  }; // End of class HyperRectDomain_MortonIterator
+
 } //namespace
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <DGtal/kernel/domains/HyperRectDomain.h> // Only for specialization purpose.
+#include <DGtal/images/Morton.h>
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -60,6 +61,17 @@ namespace DGtal
    */
   struct ColMajorStorage {};
 
+  /**
+   * @brief Tag (empty structure) specifying a Z-order (Morton) storage order.
+   *
+   * Points are indexed by interleaving the bits of their coordinates
+   * (relative to the domain lower bound), so that points that are
+   * close in space are also close in memory along every dimension.
+   *
+   * @see Linearizer, Morton
+   */
+  struct MortonStorage {};
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Aim: Linearization and de-linearization interface for domains.
@@ -174,6 +186,131 @@ namespace DGtal
 
   }; // end of class Linearizer
 
+  /**
+   * @brief Aim: Z-order (Morton) linearization and de-linearization
+   * interface for HyperRectDomain.
+   *
+   * The index of a point is the Morton code (see Morton) of its
+   * coordinates relative to the domain lower-bound. Contrary to
+   * row-major or col-major orders, the Morton order is not dense for
+   * extents that are not equal powers of two: the linearized indices
+   * of the domain points lie in [0, getSize(extent)[ but some indices
+   * in this interval have no associated point. The domain extent is
+   * thus only needed to compute this storage size.
+   *
+   * Example:
+   * @code
+   * typedef SpaceND<2>             Space;
+   * tydedef HyperRectDomain<Space> Domain;
+   * typedef typename Space::Point  Point;
+   *
+   * const Domain domain( Point(0, 1), Point(4, 3) );
+   *
+   * typedef Linearizer<Domain, MortonStorage> MortonLinearizer;
+   * MortonLinearizer::getIndex( Point(2, 2), domain ); // returns 6.
+   * MortonLinearizer::getPoint( 6, domain );           // returns Point(2,2).
+   * MortonLinearizer::getSize( domain );               // returns 25.
+   * @endcode
+   *
+   * @note Each coordinate of a point relative to the lower bound must
+   * fit in 64/dimension bits, and the resulting codes must fit in the
+   * space Size type.
+   *
+   * @tparam  TSpace       Type of the space of the HyperRectDomain (auto-deduced from TDomain template, see Linearizer).
+   */
+  template < typename TSpace >
+  struct Linearizer< HyperRectDomain<TSpace>, MortonStorage >
+    {
+      // Usefull typedefs
+      typedef HyperRectDomain<TSpace> Domain; ///< The domain type.
+      typedef typename TSpace::Point Point;   ///< The point type.
+      typedef Point Extent;                   ///< The domain's extent type.
+      typedef typename TSpace::Size  Size;    ///< The space's size type.
+      typedef DGtal::uint64_t HashKey;        ///< The type of the Morton codes.
+      typedef DGtal::Morton<HashKey, Point> MortonCode; ///< The Morton code builder.
+
+      /** Linearized index of a point, given the domain lower-bound and extent.
+       *
+       * @param[in] aPoint      The point to be linearized.
+       * @param[in] aLowerBound The lower-bound of the domain.
+       * @param[in] anExtent    The extent of the domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Point const& aLowerBound, Extent const& anExtent );
+
+      /** Linearized index of a point, given the domain extent.
+       *
+       * The lower-bound of the domain is defined to the origin.
+       *
+       * @param[in] aPoint    The Point to be linearized.
+       * @param[in] anExtent  The extent of the domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Extent const& anExtent );
+
+      /** Linearized index of a point, given a domain.
+       *
+       * @param[in] aPoint    The Point to be linearized.
+       * @param[in] aDomain   The domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Domain const& aDomain );
+
+      /** De-linearization of an index, given the domain lower-bound and extent.
+       *
+       * @param[in] anIndex     The linearized index.
+       * @param[in] aLowerBound The lower-bound of the domain.
+       * @param[in] anExtent    The domain extent.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Point const& aLowerBound, Extent const& anExtent );
+
+      /** De-linearization of an index, given the domain extent.
+       *
+       * The lower-bound of the domain is set to the origin.
+       *
+       * @param[in] anIndex   The linearized index.
+       * @param[in] anExtent  The domain extent.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Extent const& anExtent );
+
+      /** De-linearization of an index, given a domain.
+       *
+       * @param[in] anIndex   The linearized index.
+       * @param[in] aDomain   The domain.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Domain const& aDomain );
+
+      /** Size of a storage indexed by this linearizer, given the domain extent.
+       *
+       * Since the Morton code is increasing along each dimension, it is
+       * the index of the domain upper-bound plus one (or 0 for an empty
+       * extent).
+       *
+       * @param[in] anExtent  The domain extent.
+       * @return the number of elements needed to store the domain points.
+       */
+      static inline
+      Size getSize( Extent const& anExtent );
+
+      /** Size of a storage indexed by this linearizer, given a domain.
+       *
+       * @param[in] aDomain   The domain.
+       * @return the number of elements needed to store the domain points.
+       */
+      static inline
+      Size getSize( Domain const& aDomain );
+
+  }; // end of class Linearizer (MortonStorage specialization)
+
 } // namespace DGtal
 
 
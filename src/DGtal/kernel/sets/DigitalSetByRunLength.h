@@ -0,0 +1,647 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRunLength.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module DigitalSetByRunLength.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRunLength_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRunLength.h
+#else // defined(DigitalSetByRunLength_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRunLength_RECURSES
+
+#if !defined DigitalSetByRunLength_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRunLength_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+#include <utility>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/ContainerTraits.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRunLength
+  /**
+    Description of template class 'DigitalSetByRunLength' <p> \brief
+    Aim: Realizes the concept CDigitalSet by storing, for each row of
+    the space (i.e. each line parallel to the first axis), the
+    maximal runs of consecutive points of the set.
+
+    Each row is identified by a point whose first coordinate is zero,
+    and stores a sorted vector of disjoint and non-adjacent runs \f$
+    [x_b,x_e] \f$. Rows are kept in a map ordered like the scanning
+    order of HyperRectDomain, so that points are visited in domain
+    order. Empty rows are never stored.
+
+    The memory footprint is thus proportional to the number of runs,
+    i.e. to the area of the boundary of the set instead of its volume,
+    which suits large solid shapes (e.g. outputs of
+    Shapes::digitizeShape or GaussDigitizer). Membership is tested in
+    logarithmic time (a map lookup followed by a binary search in the
+    row), spans of points are inserted with insertRun(), and set
+    union, intersection and differences are computed row by row by
+    merging runs. These set operations are also used by the generic
+    functions of SetFunctions.h (functions::assignUnion,
+    functions::setops::operator| ...).
+
+    @code
+    typedef DigitalSetByRunLength< Z3i::Domain > RLESet;
+    RLESet ball( domain );
+    ball.insertRun( Z3i::Point( 0, 1, 2 ), -10, 10 ); // 21 points
+    RLESet other( domain );
+    other.assignFromImage( image, 0, 255 );
+    using namespace functions::setops;
+    RLESet inter = ball & other;
+    @endcode
+
+    @tparam TDomain a realization of the concept CDomain.
+    @see CDigitalSet, CDomain, SetFunctions.h
+   */
+  template <typename TDomain>
+  class DigitalSetByRunLength
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRunLength<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Point::Coordinate Coordinate;
+    typedef typename Point::Dimension Dimension;
+
+    /// A run of consecutive points along the first axis, as the
+    /// closed interval [first, second] of first coordinates.
+    typedef std::pair<Coordinate, Coordinate> Run;
+    /// The sorted runs of one row.
+    typedef std::vector<Run> Runs;
+
+    /// Compares rows in the scanning order of HyperRectDomain (last
+    /// coordinate first), ignoring the first coordinate.
+    struct RowLess
+    {
+      bool operator()( const Point& p1, const Point& p2 ) const
+      {
+        for ( Dimension k = Point::dimension - 1; k > 0; --k )
+          {
+            if ( p1[ k ] < p2[ k ] ) return true;
+            if ( p2[ k ] < p1[ k ] ) return false;
+          }
+        return false;
+      }
+    };
+
+    /// The rows of the set, each row being represented by a point
+    /// with first coordinate zero.
+    typedef std::map<Point, Runs, RowLess> Rows;
+
+    /**
+     * Forward iterator visiting the points of the set in the scanning
+     * order of the domain. It is invalidated by any modification of
+     * the set.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::forward_traversal_tag >
+    {
+      friend class DigitalSetByRunLength<TDomain>;
+      friend class boost::iterator_core_access;
+      typedef typename Rows::const_iterator RowConstIterator;
+
+    public:
+      /// Default constructor (invalid iterator).
+      ConstIterator() : myRun( 0 ) {}
+
+    private:
+      /// Constructor of the past-the-end iterator.
+      ConstIterator( RowConstIterator itEnd )
+        : myRow( itEnd ), myRowEnd( itEnd ), myRun( 0 ), myPoint() {}
+      /// Constructor from a row, a run index and a point of this run.
+      ConstIterator( RowConstIterator itRow, RowConstIterator itEnd,
+                     std::size_t run, const Point& p )
+        : myRow( itRow ), myRowEnd( itEnd ), myRun( run ), myPoint( p ) {}
+
+      void increment()
+      {
+        if ( myPoint[ 0 ] < myRow->second[ myRun ].second )
+          { ++myPoint[ 0 ]; return; }
+        if ( ++myRun == myRow->second.size() )
+          {
+            myRun = 0;
+            if ( ++myRow == myRowEnd ) return;
+            myPoint = myRow->first;
+          }
+        myPoint[ 0 ] = myRow->second[ myRun ].first;
+      }
+      bool equal( const ConstIterator& other ) const
+      {
+        return ( myRow == other.myRow )
+          && ( ( myRow == myRowEnd ) || ( myPoint[ 0 ] == other.myPoint[ 0 ] ) );
+      }
+      const Point& dereference() const
+      {
+        return myPoint;
+      }
+
+      /// the current row.
+      RowConstIterator myRow;
+      /// the end of the rows.
+      RowConstIterator myRowEnd;
+      /// the index of the current run in the row.
+      std::size_t myRun;
+      /// the current point.
+      Point myPoint;
+    };
+    typedef ConstIterator Iterator;
+
+    // STL-like types, used by ContainerTraits and SetFunctions.
+    typedef Point value_type;
+    typedef Point key_type;
+    typedef Size size_type;
+    typedef ConstIterator iterator;
+    typedef ConstIterator const_iterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRunLength() = default;
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRunLength( Clone<Domain> d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRunLength ( const DigitalSetByRunLength & other ) = default;
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRunLength & operator= ( const DigitalSetByRunLength & other ) = default;
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return a copy-on-write pointer on the embedding domain.
+     */
+    CowPtr<Domain> domainPointer() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (constant time).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds the span of points \f$ \{ (x, p_1, \ldots, p_{n-1}), x \in
+     * [first,last] \} \f$ to this set, merging it with the runs of
+     * its row.
+     *
+     * @param p any point of the row (its first coordinate is ignored).
+     * @param first the first coordinate of the first point of the span.
+     * @param last the first coordinate of the last point of the span.
+     * @pre first <= last and the span belongs to the associated domain.
+     */
+    void insertRun( const Point & p, Coordinate first, Coordinate last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Removes the span of points \f$ \{ (x, p_1, \ldots, p_{n-1}), x \in
+     * [first,last] \} \f$ from this set.
+     *
+     * @param p any point of the row (its first coordinate is ignored).
+     * @param first the first coordinate of the first point of the span.
+     * @param last the first coordinate of the last point of the span.
+     * @return the number of removed elements.
+     */
+    Size eraseRun( const Point & p, Coordinate first, Coordinate last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return a const iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left, computed row by row on runs.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & operator+=( const Self & aSet );
+
+    // ----------------------- Model of concepts::CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Run services -----------------------------------
+  public:
+
+    /// @return the rows of the set with their runs.
+    const Rows & rows() const;
+
+    /// @return the number of (maximal) runs of the set.
+    Size numberOfRuns() const;
+
+    /**
+     * Intersection to left, computed row by row on runs.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignIntersection( const Self & aSet );
+
+    /**
+     * Difference to left, computed row by row on runs.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignDifference( const Self & aSet );
+
+    /**
+     * Symmetric difference to left, computed row by row on runs.
+     * @param aSet any other set.
+     * @return a reference on 'this'.
+     */
+    Self & assignSymmetricDifference( const Self & aSet );
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff this set is a subset of \a aSet.
+     */
+    bool isSubset( const Self & aSet ) const;
+
+    /**
+     * @param aSet any other set.
+     * @return 'true' iff both sets have the same points. Since runs
+     * are maximal, this is a comparison of runs.
+     */
+    bool operator==( const Self & aSet ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set (linear in the number of rows).
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * Builds in this the set of points of the domain satisfying the
+     * given predicate. The domain is scanned row by row and runs are
+     * built on the fly.
+     *
+     * @tparam TPointPredicate a model of concepts::CPointPredicate.
+     * @param isForeground any point predicate.
+     */
+    template <typename TPointPredicate>
+    void assignFromPredicate( const TPointPredicate & isForeground );
+
+    /**
+     * Builds in this the set of points of the domain whose value in
+     * \a image lies in ]minVal,maxVal] (same convention as
+     * SetFromImage and functors::IntervalForegroundPredicate).
+     *
+     * @tparam TImage a model of concepts::CConstImage.
+     * @param image any image whose domain contains the domain of this set.
+     * @param minVal the minimum value (excluded).
+     * @param maxVal the maximum value (included).
+     */
+    template <typename TImage>
+    void assignFromImage( const TImage & image,
+                          const typename TImage::Value & minVal,
+                          const typename TImage::Value & maxVal );
+
+    /**
+     * Sets the value of all the points of this set that lie in the
+     * domain of \a image to \a value.
+     *
+     * @tparam TImage a model of concepts::CImage.
+     * @param[in,out] image any image.
+     * @param value the value given to the points of the set.
+     */
+    template <typename TImage>
+    void fillImage( TImage & image, const typename TImage::Value & value ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object, i.e. runs are
+     * sorted, disjoint, non-adjacent and their size sums to size().
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain. The pointed domain may be changed but it
+     * remains valid during the lifetime of the set.
+     */
+    CowPtr<Domain> myDomain;
+
+    /// The rows of the set.
+    Rows myRows;
+
+    /// The number of points of the set.
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRunLength();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @param p any point.
+    /// @return the key of the row of \a p (p with first coordinate zero).
+    static Point rowKey( const Point & p );
+
+    /// @param runs any runs.
+    /// @return the number of points of \a runs.
+    static Size count( const Runs & runs );
+
+    /// Computes in \a out the union of the runs \a r1 and \a r2.
+    static void unionOfRuns( const Runs & r1, const Runs & r2, Runs & out );
+
+    /// Computes in \a out the intersection of the runs \a r1 and \a r2.
+    static void intersectionOfRuns( const Runs & r1, const Runs & r2, Runs & out );
+
+    /// Computes in \a out the difference of the runs \a r1 and \a r2.
+    static void differenceOfRuns( const Runs & r1, const Runs & r2, Runs & out );
+
+    /**
+     * Scans the rows of the bounding box of the domain in domain
+     * order and calls \a visitor( row, runs ) for each row containing
+     * points of the domain that satisfy \a pred, \a runs being these
+     * points.
+     */
+    template <typename TPointPredicate, typename TRowVisitor>
+    void scanDomain( const TPointPredicate & pred, TRowVisitor & visitor ) const;
+
+    /// Point predicate telling if a point is not in a set.
+    struct NotInSet
+    {
+      const Self* mySet;
+      bool operator()( const Point & p ) const { return ! (*mySet)( p ); }
+    };
+
+    /// Row visitor appending the rows to a set.
+    struct RowAppender
+    {
+      Self* mySet;
+      void operator()( const Point & row, Runs & runs ) const;
+    };
+
+    /// Row visitor writing the points of the rows to an output iterator.
+    template <typename TOutputIterator>
+    struct RowWriter
+    {
+      TOutputIterator* myIt;
+      void operator()( const Point & row, Runs & runs ) const;
+    };
+
+  }; // end of class DigitalSetByRunLength
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRunLength'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRunLength' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByRunLength<Domain> & object );
+
+  /// Defines container traits for DigitalSetByRunLength (an ordered
+  /// set of points).
+  template <typename TDomain>
+  struct ContainerTraits< DigitalSetByRunLength<TDomain> >
+  {
+    typedef SetAssociativeCategory Category;
+  };
+
+  namespace detail {
+
+    /**
+     * Specialization of set operations for DigitalSetByRunLength,
+     * which are computed on runs instead of points.
+     */
+    template <typename TDomain>
+    struct SetFunctionsImpl< DigitalSetByRunLength<TDomain>, true, true >
+    {
+      typedef DigitalSetByRunLength<TDomain> Container;
+
+      static bool isEqual( const Container& S1, const Container& S2 )
+      { return S1 == S2; }
+
+      static bool isSubset( const Container& S1, const Container& S2 )
+      { return S1.isSubset( S2 ); }
+
+      static Container& assignDifference( Container& S1, const Container& S2 )
+      { return S1.assignDifference( S2 ); }
+
+      static Container& assignUnion( Container& S1, const Container& S2 )
+      { return S1 += S2; }
+
+      static Container& assignIntersection( Container& S1, const Container& S2 )
+      { return S1.assignIntersection( S2 ); }
+
+      static Container& assignSymmetricDifference( Container& S1, const Container& S2 )
+      { return S1.assignSymmetricDifference( S2 ); }
+    };
+
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRunLength.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRunLength_h
+
+#undef DigitalSetByRunLength_RECURSES
+#endif // else defined(DigitalSetByRunLength_RECURSES)
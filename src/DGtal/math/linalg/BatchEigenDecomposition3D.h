@@ -0,0 +1,306 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchEigenDecomposition3D.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module BatchEigenDecomposition3D.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchEigenDecomposition3D_RECURSES)
+#error Recursive header files inclusion detected in BatchEigenDecomposition3D.h
+#else // defined(BatchEigenDecomposition3D_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchEigenDecomposition3D_RECURSES
+
+#if !defined BatchEigenDecomposition3D_h
+/** Prevents repeated inclusion of headers. */
+#define BatchEigenDecomposition3D_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchEigenDecomposition3D
+  /**
+     Description of template class 'BatchEigenDecomposition3D' <p>
+     \brief Aim: Computes the eigenvalues and eigenvectors of many
+     real symmetric 3x3 matrices at once.
+
+     The matrices are given in a structure-of-arrays layout: six
+     arrays holding their coefficients xx, xy, xz, yy, yz and zz. The
+     eigenvalues and the eigenvectors are returned in the same layout.
+     Covariance-based estimators (e.g. the Voronoi covariance measure)
+     diagonalize one such matrix per surface element, and the
+     tridiagonalization and QL iterations of EigenDecomposition, written
+     for any dimension, dominate for these small matrices.
+
+     Each matrix is diagonalized by the cyclic Jacobi method, whose
+     iterations are the same for all the matrices. The matrices are
+     thus processed by chunks of #chunkSize matrices, each rotation
+     being applied to all the matrices of a chunk by a loop without
+     branches that the compiler vectorizes. A chunk is iterated until
+     all its matrices are diagonal up to the machine precision. The
+     chunks are processed in parallel when DGtal is built with OpenMP.
+
+     As with EigenDecomposition, the eigenvalues are sorted from the
+     smallest to the biggest and the eigenvectors are orthonormal and
+     stored in the columns of the eigenvector matrix. Each eigenvector
+     is defined up to its sign.
+
+     @code
+     std::vector<Z3i::RealMatrix> matrices; // symmetric matrices
+     BatchEigenDecomposition3D<double> batch;
+     batch.compute( matrices );
+     Z3i::RealMatrix vectors;
+     Z3i::RealVector values;
+     batch.getEigenDecomposition( 0, vectors, values );
+     @endcode
+
+     @tparam TComponent the type of the coefficients, a floating-point
+     type (float, double or long double).
+
+     @see EigenDecomposition, testBatchEigenDecomposition3D.cpp
+   */
+  template <typename TComponent>
+  class BatchEigenDecomposition3D
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TComponent Component;
+    typedef PointVector<3, Component> Vector;
+    typedef SimpleMatrix<Component, 3, 3> Matrix;
+    typedef std::vector<Component> Components;
+    typedef std::size_t Index;
+
+    /// The number of matrices diagonalized together.
+    static const Index chunkSize = 16;
+    /// The maximal number of Jacobi sweeps per chunk.
+    static const unsigned int maxNbSweeps = 32;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The object has no matrix.
+    */
+    BatchEigenDecomposition3D();
+
+    /**
+       Diagonalizes the given symmetric matrices. All the arrays have
+       the same size, the number of matrices.
+
+       @param xx the coefficients (0,0) of the matrices.
+       @param xy the coefficients (0,1) of the matrices.
+       @param xz the coefficients (0,2) of the matrices.
+       @param yy the coefficients (1,1) of the matrices.
+       @param yz the coefficients (1,2) of the matrices.
+       @param zz the coefficients (2,2) of the matrices.
+       @param nbBlocks the number of blocks of matrices processed
+       independently, 0 means a few blocks per available thread.
+    */
+    void compute( const Components & xx, const Components & xy,
+                  const Components & xz, const Components & yy,
+                  const Components & yz, const Components & zz,
+                  unsigned int nbBlocks = 0 );
+
+    /**
+       Diagonalizes the given symmetric matrices. Only their upper
+       triangular part is read.
+
+       @param matrices the matrices.
+       @param nbBlocks the number of blocks of matrices processed
+       independently, 0 means a few blocks per available thread.
+    */
+    void compute( const std::vector<Matrix> & matrices,
+                  unsigned int nbBlocks = 0 );
+
+    /**
+       Diagonalizes one symmetric matrix with the same method. Only
+       its upper triangular part is read.
+
+       @param matrix the matrix.
+       @param eigenVectors (returns) the eigenvectors, as columns.
+       @param eigenValues (returns) the eigenvalues, in increasing order.
+    */
+    static void getEigenDecomposition( const Matrix & matrix,
+                                       Matrix & eigenVectors,
+                                       Vector & eigenValues );
+
+    // ----------------------- Accessors ------------------------------
+  public:
+
+    /// @return the number of matrices.
+    Index size() const;
+
+    /**
+       @param k the index of a matrix.
+       @return its eigenvalues, in increasing order.
+    */
+    Vector eigenValues( Index k ) const;
+
+    /**
+       @param k the index of a matrix.
+       @return its eigenvectors, as columns.
+    */
+    Matrix eigenVectors( Index k ) const;
+
+    /**
+       @param k the index of a matrix.
+       @param eigenVectors (returns) its eigenvectors, as columns.
+       @param eigenValues (returns) its eigenvalues, in increasing order.
+    */
+    void getEigenDecomposition( Index k,
+                                Matrix & eigenVectors,
+                                Vector & eigenValues ) const;
+
+    /**
+       @param i an index in {0,1,2}.
+       @return the i-th eigenvalues of all the matrices.
+    */
+    const Components & values( Dimension i ) const;
+
+    /**
+       @param r a row in {0,1,2}.
+       @param c a column in {0,1,2}.
+       @return the r-th coordinates of the c-th eigenvectors of all
+       the matrices.
+    */
+    const Components & vectors( Dimension r, Dimension c ) const;
+
+    /// @return the maximal number of Jacobi sweeps over the chunks
+    /// of the last computation.
+    unsigned int nbSweeps() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+       Writes/Displays the object on an output stream.
+       @param out the output stream where the object is written.
+    */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+       Checks the validity/consistency of the object.
+       @return 'true' if the object is valid, 'false' otherwise.
+    */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Diagonalizes a chunk of at most W matrices.
+
+       @tparam W the width of the chunk.
+       @param n the number of matrices of the chunk.
+       @param in the six arrays of coefficients, from the first matrix
+       of the chunk.
+       @param values (returns) the three arrays of eigenvalues, from
+       the first matrix of the chunk.
+       @param vectors (returns) the nine arrays of eigenvector
+       coordinates, from the first matrix of the chunk.
+       @return the number of sweeps.
+    */
+    template <Index W>
+    static unsigned int decompose( Index n,
+                                   const Component * const in[ 6 ],
+                                   Component * const values[ 3 ],
+                                   Component * const vectors[ 9 ] );
+
+    /**
+       Applies to a chunk the Jacobi rotation cancelling the
+       coefficients (p,q) of its matrices.
+
+       @tparam W the width of the chunk.
+       @tparam p the smallest index of the pivot.
+       @tparam q the biggest index of the pivot.
+       @param a (modified) the six arrays of coefficients.
+       @param v (modified) the nine arrays of eigenvector coordinates.
+    */
+    template <Index W, Dimension p, Dimension q>
+    static void rotate( Component (&a)[ 6 ][ W ], Component (&v)[ 9 ][ W ] );
+
+    /**
+       Sorts the eigenvalues i and j of a chunk, and the corresponding
+       eigenvectors.
+
+       @tparam W the width of the chunk.
+       @tparam i the index of the first eigenvalue.
+       @tparam j the index of the second eigenvalue, bigger than @a i.
+       @param a (modified) the six arrays of coefficients.
+       @param v (modified) the nine arrays of eigenvector coordinates.
+    */
+    template <Index W, Dimension i, Dimension j>
+    static void sort( Component (&a)[ 6 ][ W ], Component (&v)[ 9 ][ W ] );
+
+    /**
+       @param nbBlocks a number of blocks, 0 for the default.
+       @param n the number of items.
+       @return the number of blocks to process @a n items.
+    */
+    static Index blockNumber( unsigned int nbBlocks, Index n );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The eigenvalues of the matrices.
+    Components myValues[ 3 ];
+    /// The eigenvector coordinates of the matrices, row by row.
+    Components myVectors[ 9 ];
+    /// The maximal number of sweeps of the last computation.
+    unsigned int myNbSweeps;
+
+  }; // end of class BatchEigenDecomposition3D
+
+  /**
+     Overloads 'operator<<' for displaying objects of class 'BatchEigenDecomposition3D'.
+     @param out the output stream where the object is written.
+     @param object the object of class 'BatchEigenDecomposition3D' to write.
+     @return the output stream after the writing.
+  */
+  template <typename TComponent>
+  std::ostream&
+  operator<< ( std::ostream & out, const BatchEigenDecomposition3D<TComponent> & object );
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/math/linalg/BatchEigenDecomposition3D.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchEigenDecomposition3D_h
+
+#undef BatchEigenDecomposition3D_RECURSES
+#endif // else defined(BatchEigenDecomposition3D_RECURSES)
@@ -32,7 +32,9 @@
 
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
+#include <vector>
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/Bits.h"
 #include "DGtal/base/ConstAlias.h"
 #include "DGtal/shapes/Mesh.h"
 #include "DGtal/shapes/IntersectionTarget.h"
@@ -71,6 +73,15 @@ namespace DGtal
    @image html 6-sep.png "Template for 6-separating digitization"
    @image html 26-sep.png "Template for 26-separating digitization"
 
+   Meshes are voxelized by tiles of tileSize^3 voxels of the domain,
+   processed in parallel with OpenMP: triangles are first binned into
+   the tiles their bounding box overlaps, then each tile tests its
+   triangles row by row against its voxels and records them in its
+   own bit array, so that no synchronization is needed before the
+   voxels are inserted into the output set. The solid voxelization
+   (voxelizeSolid) adds the voxels whose center is inside the mesh,
+   determined by the parity of the mesh crossings along the z axis.
+
 
    @tparam TDigitalSet a DigitalSet (model of concepts::CDigitalSet)
    @tparam Separation strategy of the voxelization (6 or 26)
@@ -102,8 +113,12 @@ namespace DGtal
     using PointZ3  = typename Space::Point;
     using OrientationFunctor = InHalfPlaneBySimple3x3Matrix<PointR2, double>;
     using IntersectionTarget = typename IntersectionTargetTrait<Space, Separation, 1>::Type;
+    using BoundingBox = std::pair<PointZ3, PointZ3>;
     /*********************************************/
 
+    /// Size of the side of the tiles (in voxels) processed in parallel.
+    static const int tileSize = 16;
+
   public:
 
     /**
@@ -151,6 +166,25 @@ namespace DGtal
                   const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
                   const double scaleFactor = 1.0);
 
+    /**
+     * Voxelize the mesh and its interior into the digital set. The
+     * voxels of the mesh voxelization (see voxelize) are completed by
+     * the voxels whose center is inside the mesh, i.e. such that the
+     * half-line from the center along the z axis crosses the mesh an
+     * odd number of times. The mesh should thus be closed.
+     *
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] aMesh the mesh to voxelize (vertex coordinates will
+     * be casted to @e PointR3 points.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * (default=1.0)
+     * @tparam MeshPoint the type of point of the mesh.
+     */
+    template<typename MeshPoint>
+    void voxelizeSolid(DigitalSet &outputSet,
+                       const Mesh<MeshPoint> &aMesh,
+                       const double scaleFactor = 1.0);
+
 
 
     // ----------------------- Internal services ------------------------------
@@ -210,6 +244,125 @@ namespace DGtal
                           const VectorR3& n,
                           const std::pair<PointZ3, PointZ3>& bbox);
 
+    // ----------------------- Hidden services ------------------------------
+  protected:
+
+    /// A triangle of the mesh, scaled, with its normal and its bounding box.
+    struct ScaledTriangle
+    {
+      PointR3 A, B, C;
+      VectorR3 n;
+      BoundingBox bbox;
+    };
+
+    /**
+     * @param [in] a the first point of the triangle
+     * @param [in] b the second point of the triangle
+     * @param [in] c the third point of the triangle
+     * @param [in] scaleFactor the scale factor to apply to the triangle
+     * @return the scaled triangle, its normal and its bounding box.
+     */
+    template<typename MeshPoint>
+    static
+    ScaledTriangle scaledTriangle(const MeshPoint &a, const MeshPoint &b, const MeshPoint &c,
+                                  const double scaleFactor);
+
+    /**
+     * Triangulates the faces of the mesh by triangle fans and scales them.
+     * @param [in] aMesh the mesh to voxelize.
+     * @param [in] scaleFactor the scale factor to apply to the mesh
+     * @return the scaled triangles of the mesh.
+     */
+    template<typename MeshPoint>
+    static
+    std::vector<ScaledTriangle> scaledTriangles(const Mesh<MeshPoint> &aMesh,
+                                                const double scaleFactor);
+
+    /**
+     * Bins the triangles into the tiles overlapped by their bounding box.
+     * @param [in] triangles the triangles.
+     * @param [in] domain the domain covered by the tiles.
+     * @param [in] nbAxes the number of axes along which the domain is
+     * cut in tiles of side tileSize (the other axes are not cut and
+     * not tested).
+     * @param [out] nbTiles the number of tiles along each axis.
+     * @param [out] offsets the offsets of the tiles in @a indices.
+     * @param [out] indices the indices of the triangles of each tile.
+     */
+    static
+    void binTriangles(const std::vector<ScaledTriangle> &triangles,
+                      const Domain &domain, const Dimension nbAxes,
+                      PointZ3 &nbTiles,
+                      std::vector<std::size_t> &offsets,
+                      std::vector<std::size_t> &indices);
+
+    /**
+     * @param [in] domain the domain covered by the tiles.
+     * @param [in] nbAxes the number of axes cut in tiles.
+     * @param [in] nbTiles the number of tiles along each axis.
+     * @param [in] t the index of a tile.
+     * @return the box of the tile @a t.
+     */
+    static
+    BoundingBox tileBox(const Domain &domain, const Dimension nbAxes,
+                        const PointZ3 &nbTiles, const std::size_t t);
+
+    /**
+     * Voxelize ABC in the given box. The voxels are recorded in a bit
+     * array covering the box @a box, ordered by x, then y, then z.
+     * @param T the triangle
+     * @param box the box of the voxels to test.
+     * @param [in,out] bits the bits of the voxels of box @a box.
+     */
+    void voxelizeTriangle(const ScaledTriangle &T,
+                          const BoundingBox &box,
+                          std::vector<DGtal::uint64_t> &bits);
+
+    /**
+     * Appends the voxels of a bit array to a vector of points.
+     * @param box the box of the voxels of the bit array.
+     * @param bits the bits of the voxels of box @a box, ordered by x,
+     * then y, then z.
+     * @param [in,out] points the points of the voxels whose bit is set.
+     */
+    static
+    void bitsToPoints(const BoundingBox &box,
+                      const std::vector<DGtal::uint64_t> &bits,
+                      std::vector<PointZ3> &points);
+
+    /**
+     * Computes the crossings of the columns of voxel centers of the
+     * given box with triangle ABC. A column is crossed if its (x,y)
+     * is inside the projection of ABC on the xy-plane, points on
+     * edges being assigned to only one of two triangles sharing this
+     * edge.
+     * @param T the triangle
+     * @param box the box of the columns.
+     * @param [in,out] crossings the crossings (index of column in the
+     * box ordered by x then y, z coordinate of the crossing).
+     */
+    static
+    void crossTriangle(const ScaledTriangle &T,
+                       const BoundingBox &box,
+                       std::vector< std::pair<std::size_t, double> > &crossings);
+
+    /**
+     * Voxelize the triangles into the digital set, tile by tile.
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] triangles the scaled triangles of the mesh.
+     */
+    void voxelizeTriangles(DigitalSet &outputSet,
+                           const std::vector<ScaledTriangle> &triangles);
+
+    /**
+     * Inserts in the digital set the voxels whose center is inside
+     * the triangles, column by column.
+     * @param [out] outputSet the set that collects the voxels.
+     * @param [in] triangles the scaled triangles of a closed mesh.
+     */
+    void fillTriangles(DigitalSet &outputSet,
+                       const std::vector<ScaledTriangle> &triangles);
+
     // ----------------------- Members ------------------------------
 
   private:
@@ -45,6 +45,7 @@
 #include <string>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IntegerSequenceIterator.h"
+#include "DGtal/base/PackedRanges.h"
 #include "DGtal/helpers/StdDefs.h"
 
 namespace DGtal
@@ -84,6 +85,14 @@ namespace DGtal
      See also SurfaceMeshReader and SurfaceMeshWriter for input/output
      operations for SurfaceMesh.
 
+     The connectivity (incident vertices and faces, neighbors, edges)
+     is computed once at initialization, by sorting and scanning the
+     edges of the faces, in parallel when DGtal is built with
+     OpenMP. It is then immutable and stored in compressed sparse row
+     layout (see PackedRanges): the accessors return read-only
+     contiguous ranges (IndexRange), which behave as const vectors
+     and convert to them.
+
      @tparam TRealPoint an arbitrary model of 3D RealPoint.
      @tparam TRealVector an arbitrary model of 3D RealVector.
   */
@@ -116,6 +125,12 @@ namespace DGtal
     typedef std::vector< Face >                     Faces;
     typedef std::vector< WeightedFace >             WeightedFaces;
     typedef std::pair< Vertex, Vertex >             VertexPair;
+    /// The type storing a relation between elements (e.g. the
+    /// incident faces of each vertex) as one range per element.
+    typedef PackedRanges< Index >                   IndexRanges;
+    /// The type of the range of elements related to one element
+    /// (e.g. the incident faces of one vertex).
+    typedef typename IndexRanges::Range             IndexRange;
 
     // Required by CUndirectedSimpleLocalGraph
     typedef std::set<Vertex>                   VertexSet;
@@ -296,29 +311,29 @@ namespace DGtal
     /// @param j any vertex of the mesh
     /// @return the edge index of edge (i,j) or `nbEdges()` if this
     /// edge does not exist.
-    /// @note O(log E) time complexity.
+    /// @note O(log d) time complexity, d being the number of edges
+    /// (min(i,j),k) with k > min(i,j).
     Edge makeEdge( Vertex i, Vertex j ) const;
 
     /// @param f any face
-    /// @return a const reference to the range giving for face \a f 
-    /// its incident vertices.
-    const Vertices&  incidentVertices( Face f ) const
+    /// @return the range giving for face \a f its incident vertices.
+    IndexRange incidentVertices( Face f ) const
     { return myIncidentVertices[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range giving for vertex \a v
-    /// its incident faces.
-    const Faces& incidentFaces( Vertex v ) const
+    /// @return the range giving for vertex \a v its incident faces
+    /// (in increasing order).
+    IndexRange incidentFaces( Vertex v ) const
     { return myIncidentFaces[ v ]; }
     
     /// @param f any face
-    /// @return a const reference to the range of neighbor faces for face \a f.
-    const Faces& neighborFaces( Face f ) const
+    /// @return the range of neighbor faces for face \a f (in increasing order).
+    IndexRange neighborFaces( Face f ) const
     { return myNeighborFaces[ f ]; }
 
     /// @param v any vertex
-    /// @return a const reference to the range of neighbor vertices for vertex \a v.
-    const Vertices& neighborVertices( Vertex v ) const
+    /// @return the range of neighbor vertices for vertex \a v (in increasing order).
+    IndexRange neighborVertices( Vertex v ) const
     { return myNeighborVertices[ v ]; }
 
     /// @param e any edge
@@ -328,49 +343,47 @@ namespace DGtal
     { return myEdgeVertices[ e ]; }
     
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
-    /// its incident faces (one, two, or more if non manifold)
-    const Faces& edgeFaces( Edge e ) const
+    /// @return the range giving for edge \a e its incident faces
+    /// (one, two, or more if non manifold)
+    IndexRange edgeFaces( Edge e ) const
     { return myEdgeFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
-    /// its incident faces to its right (zero if open, one, or more if
-    /// non manifold).
+    /// @return the range giving for edge \a e its incident faces to
+    /// its right (zero if open, one, or more if non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const Faces& edgeRightFaces( Edge e ) const 
+    IndexRange edgeRightFaces( Edge e ) const
     { return myEdgeRightFaces[ e ]; }
 
     /// @param e any edge
-    /// @return a const reference to the range giving for edge \a e
-    /// its incident faces to its left (zero if open, one, or more if
-    /// non manifold).
+    /// @return the range giving for edge \a e its incident faces to
+    /// its left (zero if open, one, or more if non manifold).
     ///
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const Faces& edgeLeftFaces( Edge e ) const 
+    IndexRange edgeLeftFaces( Edge e ) const
     { return myEdgeLeftFaces[ e ]; }
 
     /// @return a const reference to the vector giving for each face
     /// its incident vertices.
-    const std::vector< Vertices >& allIncidentVertices() const
+    const IndexRanges& allIncidentVertices() const
     { return myIncidentVertices; }
 
     /// @return a const reference to the vector giving for each vertex
     /// its incident faces.
-    const std::vector< Faces >& allIncidentFaces() const
+    const IndexRanges& allIncidentFaces() const
     { return myIncidentFaces; }
     
     /// @return a const reference to the vector of neighbor faces for each face.
-    const std::vector< Faces >& allNeighborFaces() const
+    const IndexRanges& allNeighborFaces() const
     { return myNeighborFaces; }
 
     /// @return a const reference to the vector of neighbor vertices for each vertex.
-    const std::vector< Vertices >& allNeighborVertices() const
+    const IndexRanges& allNeighborVertices() const
     { return myNeighborVertices; }
 
     /// @return a const reference to the vector giving for each edge
@@ -381,7 +394,7 @@ namespace DGtal
     
     /// @return a const reference to the vector giving for each edge
     /// its incident faces (one, two, or more if non manifold)
-    const std::vector< Faces >& allEdgeFaces() const
+    const IndexRanges& allEdgeFaces() const
     { return myEdgeFaces; }
 
     /// @return a const reference to the vector giving for each edge
@@ -391,7 +404,7 @@ namespace DGtal
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    const std::vector< Faces >& allEdgeRightFaces() const 
+    const IndexRanges& allEdgeRightFaces() const
     { return myEdgeRightFaces; }
 
     /// @return a const reference to the vector giving for each edge
@@ -401,7 +414,7 @@ namespace DGtal
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    const std::vector< Faces >& allEdgeLeftFaces() const 
+    const IndexRanges& allEdgeLeftFaces() const
     { return myEdgeLeftFaces; }
     
     /// @}
@@ -718,35 +731,38 @@ namespace DGtal
     // ------------------------- Protected Datas ------------------------------
   protected:
     /// For each face, its range of incident vertices
-    std::vector< Vertices >     myIncidentVertices;
+    IndexRanges                 myIncidentVertices;
     /// For each vertex, its range of incident faces
-    std::vector< Faces >        myIncidentFaces;
+    IndexRanges                 myIncidentFaces;
     /// For each vertex, its position
     std::vector< RealPoint >    myPositions;
     /// For each vertex, its normal vector
     std::vector< RealVector >   myVertexNormals;
     /// For each face, its normal vector
     std::vector< RealVector >   myFaceNormals;
-    /// For each face, its range of neighbor faces (no particular order)
-    std::vector< Faces >        myNeighborFaces;
-    /// For each vertex, its range of neighbor vertices (no particular order)
-    std::vector< Vertices >     myNeighborVertices;
-    /// For each edge, its two vertices
+    /// For each face, its range of neighbor faces (increasing order)
+    IndexRanges                 myNeighborFaces;
+    /// For each vertex, its range of neighbor vertices (increasing order)
+    IndexRanges                 myNeighborVertices;
+    /// For each edge, its two vertices (edges are sorted)
     std::vector< VertexPair >   myEdgeVertices;
+    /// For each vertex i, the index of the first edge (i,j) with i <
+    /// j, and the number of edges at the end.
+    std::vector< Edge >         myFirstEdges;
     /// For each edge, its faces (one, two, or more if non manifold)
-    std::vector< Faces >        myEdgeFaces;
+    IndexRanges                 myEdgeFaces;
     /// For each edge, its faces to its right  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its right, being defined ccw, means that the face is
     /// some `(..., j, i, ... )`.
-    std::vector< Faces >        myEdgeRightFaces;
+    IndexRanges                 myEdgeRightFaces;
     /// For each edge, its faces to its left  (zero if open, one, or more if
     /// non manifold).
     /// @note an edge is stored as a vertex pair (i,j), i < j. So a
     /// face to its left, being defined ccw, means that the face is
     /// some `(..., i, j, ... )`.
-    std::vector< Faces >        myEdgeLeftFaces;
+    IndexRanges                 myEdgeLeftFaces;
 
     // ------------------------- Private Datas --------------------------------
   private:
@@ -755,11 +771,29 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   protected:
 
+    /// Computes the incident faces of each vertex.
+    void computeIncidentFaces();
     /// Computes neighboring information.
     void computeNeighbors();
     /// Computes edge information.
     void computeEdges();
 
+    /// Builds packed ranges, the ranges being computed in parallel.
+    ///
+    /// @tparam RangeFunction the type of a function (Index,
+    /// std::vector<Index>&) -> void, which outputs the range of an
+    /// element in the given empty vector. It is called concurrently.
+    ///
+    /// @param[out] ranges the packed ranges.
+    /// @param[in] n the number of ranges.
+    /// @param[in] f the function computing each range.
+    template <typename RangeFunction>
+    static void computeRanges( IndexRanges& ranges, Size n, RangeFunction f );
+
+    /// @param[in] n a number of elements.
+    /// @return the number of blocks of elements processed in parallel.
+    static long nbBlocks( Size n );
+
     /// @return a random number between 0.0 and 1.0
     static Scalar rand01()
     { return (Scalar) rand() / (Scalar) RAND_MAX; }
@@ -42,6 +42,9 @@
 // Inclusions
 #include <iostream>
 #include <array>
+#include <vector>
+#include <map>
+#include <set>
 #include "DGtal/base/Common.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -76,6 +79,12 @@ namespace DGtal
    * std::cout << mesh << std::endl;
    * \endcode
    *
+   * The construction does not use any map: the arcs of the faces are
+   * sorted by radix sort and matched with the sorted edges to pair
+   * opposite half-edges, in time and memory linear in the number of
+   * half-edges (apart from the arc to half-edge mapping that is kept
+   * for halfEdgeIndexFromArc).
+   *
    * @note Large parts of this class are taken from
    * https://github.com/yig/halfedge, written by Yotam Gingold.
    */
@@ -228,30 +237,7 @@ namespace DGtal
      * one).
      */
     static Size getUnorderedEdgesFromTriangles
-    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out )
-    {
-      typedef std::set< Edge > EdgeSet;
-      typedef std::set< VertexIndex > VertexIndexSet;
-      VertexIndexSet vertexSet;
-      EdgeSet edgeSet;
-      for( const Triangle& T : triangles )
-        {
-          edgeSet.insert( Edge( T.i(), T.j() ) );
-          edgeSet.insert( Edge( T.j(), T.k() ) );
-          edgeSet.insert( Edge( T.k(), T.i() ) );
-          vertexSet.insert( T.i() );
-          vertexSet.insert( T.j() );
-          vertexSet.insert( T.k() );
-        }
-      edges_out.resize( edgeSet.size() );
-      Size e = 0;
-      for ( const Edge& edge : edgeSet )
-        {
-          edges_out.at(e) = edge;
-          ++e;
-        }
-      return vertexSet.size();
-    }
+    ( const std::vector<Triangle>& triangles, std::vector< Edge >& edges_out );
 
     /** 
      * Computes all the unoriented edges of the given polygonal faces.
@@ -333,9 +319,12 @@ namespace DGtal
      */
     bool build( const std::vector<Triangle>& triangles )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromTriangles( triangles, edges );
-      return build( nbVtx, triangles, edges );
+      std::vector<Index>       offsets;
+      std::vector<VertexIndex> vertices;
+      std::vector<Edge>        edges;
+      getFaceVertices( triangles, offsets, vertices );
+      const Size nbVtx = getUnorderedEdges( offsets, vertices, edges );
+      return build( nbVtx, offsets, vertices, edges );
     }
 
     /**
@@ -348,9 +337,12 @@ namespace DGtal
      */
     bool build( const std::vector<PolygonalFace>& polygonal_faces )
     {
-      std::vector<Edge> edges;
-      const Size nbVtx = getUnorderedEdgesFromPolygonalFaces( polygonal_faces, edges );
-      return build( nbVtx, polygonal_faces, edges );
+      std::vector<Index>       offsets;
+      std::vector<VertexIndex> vertices;
+      std::vector<Edge>        edges;
+      getFaceVertices( polygonal_faces, offsets, vertices );
+      const Size nbVtx = getUnorderedEdges( offsets, vertices, edges );
+      return build( nbVtx, offsets, vertices, edges );
     }
 
     /// Clears the data structure.
@@ -1409,23 +1401,93 @@ namespace DGtal
     // ------------------------- Hidden services ------------------------------
   protected:
 
-    static
-    FaceIndex arc2FaceIndex( const Arc2FaceIndex& de2fi,
-                             VertexIndex vi, VertexIndex vj )
-    {
-      ASSERT( !de2fi.empty() );
+    /**
+     * Stores the vertices of the given triangles one after the other.
+     *
+     * @param[in] triangles the vector of input triangles.
+     * @param[out] offsets the offsets of the faces in \a vertices (one
+     * more than the number of faces, the vertices of face f are at
+     * indices [offsets[f],offsets[f+1])).
+     * @param[out] vertices the vertices of all the faces.
+     */
+    static void getFaceVertices( const std::vector<Triangle>& triangles,
+                                 std::vector<Index>&          offsets,
+                                 std::vector<VertexIndex>&    vertices );
 
-      Arc2FaceIndex::const_iterator it = de2fi.find( Arc( vi, vj ) );
-      // If no such directed edge exists, then there's no such face in the mesh.
-      // The edge must be a boundary edge.
-      // In this case, the reverse orientation edge must have a face.
-      if( it == de2fi.end() )
-        {
-          ASSERT( de2fi.find( Arc( vj, vi ) ) != de2fi.end() );
-          return HALF_EDGE_INVALID_INDEX;
-        }
-      return it->second;
-    }
+    /**
+     * Stores the vertices of the given polygonal faces one after the other.
+     *
+     * @param[in] polygonal_faces the vector of input polygonal faces.
+     * @param[out] offsets the offsets of the faces in \a vertices (one
+     * more than the number of faces, the vertices of face f are at
+     * indices [offsets[f],offsets[f+1])).
+     * @param[out] vertices the vertices of all the faces.
+     */
+    static void getFaceVertices( const std::vector<PolygonalFace>& polygonal_faces,
+                                 std::vector<Index>&               offsets,
+                                 std::vector<VertexIndex>&         vertices );
+
+    /**
+     * Computes all the unoriented edges of the given faces, sorted
+     * in lexicographic order.
+     *
+     * @param[in] offsets the offsets of the faces in \a vertices.
+     * @param[in] vertices the vertices of all the faces.
+     * @param[out] edges_out the vector of all the unoriented edges of
+     * the given faces.
+     *
+     * @return the total number of different vertices.
+     *
+     * @see getFaceVertices
+     */
+    static Size getUnorderedEdges( const std::vector<Index>&       offsets,
+                                   const std::vector<VertexIndex>& vertices,
+                                   std::vector< Edge >&            edges_out );
+
+    /**
+     * Builds the half-edge data structures from the given faces and
+     * edges. The arcs of the faces and the edges are sorted by radix
+     * sort, and then matched by a linear scan, so that no map is
+     * needed to pair opposite half-edges.
+     *
+     * @param[in] num_vertices the number of vertices (one more than the
+     * maximal vertex index).
+     * @param[in] offsets the offsets of the faces in \a vertices.
+     * @param[in] vertices the vertices of all the faces.
+     * @param[in] edges the vector of input unoriented edges.
+     *
+     * @return 'true' if everything went well, 'false' if their was
+     * error in the given topology.
+     *
+     * @see getFaceVertices
+     */
+    bool build( const Size                      num_vertices,
+                const std::vector<Index>&       offsets,
+                const std::vector<VertexIndex>& vertices,
+                const std::vector<Edge>&        edges );
+
+    /**
+     * Sorts the given items by increasing key with a least
+     * significant digit radix sort, which is stable. Each pass
+     * processes blocks of items in parallel with OpenMP.
+     *
+     * @tparam Item the type of the sorted items.
+     * @tparam KeyFunction the type of a function Item -> Size.
+     * @param[in,out] items the items to sort.
+     * @param[in] nb_bits the number of significant bits of the keys.
+     * @param[in] key the function giving the key of an item.
+     */
+    template <typename Item, typename KeyFunction>
+    static void radixSort( std::vector<Item>& items, unsigned int nb_bits,
+                           KeyFunction key );
+
+    /// @param n any integer.
+    /// @return the number of bits needed to write \a n.
+    static unsigned int nbBits( Size n );
+
+    /// @param n the number of elements to process.
+    /// @return the number of blocks for processing \a n elements in parallel.
+    static long nbBlocks( Size n );
         
   }; // end of class HalfEdgeDataStructure
 
@@ -0,0 +1,282 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file RasterContourFollower.h
+ *
+ * @date 2026/10/19
+ *
+ * Header file for module RasterContourFollower.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(RasterContourFollower_RECURSES)
+#error Recursive header files inclusion detected in RasterContourFollower.h
+#else // defined(RasterContourFollower_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define RasterContourFollower_RECURSES
+
+#if !defined RasterContourFollower_h
+/** Prevents repeated inclusion of headers. */
+#define RasterContourFollower_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/SurfelAdjacency.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RasterContourFollower
+  /**
+     Description of template class 'RasterContourFollower' <p> \brief
+     Aim: A utility class for extracting all the contours of a 2D
+     shape, given by a predicate on points, in one raster scan of the
+     bounds of a 2D cellular grid space.
+
+     Contrary to Surfaces::extractAll2DSCellContours, which computes
+     the set of boundary surfels and then tracks each contour with
+     Surfaces::track2DBoundary, the contours are followed as in the
+     border following of Suzuki and Abe: the pointels are scanned in
+     raster order and each boundary linel not yet visited starts a new
+     contour, which is followed at once. The choice of the next linel
+     only depends on the four pixels around the current pointel, and a
+     linel is marked in a small array of flags, so that each boundary
+     linel is visited a constant number of times and no set of cells
+     is built.
+
+     Contours are oriented with the shape on their left (outer
+     contours are counterclockwise, hole contours are clockwise), as
+     Surfaces::track2DBoundary. They are returned as closed Freeman
+     chains of pointels (or as grid curves), starting at their smallest
+     linel in raster order, and sorted by starting linel. The surfel
+     adjacency decides how two shape pixels sharing only a pointel are
+     handled: an interior adjacency (int2ext) turns around the current
+     pixel, hence separates them (the shape is 4-connected), an
+     exterior adjacency goes to the other pixel (the shape is
+     8-connected).
+
+     The pointel rows may be cut into strips followed independently
+     (in parallel when DGtal is built with OpenMP): contours crossing
+     strips are followed by pieces which are stitched afterwards. The
+     result does not depend on the number of strips.
+
+     @code
+     Z2i::KSpace K;
+     K.init( domain.lowerBound(), domain.upperBound(), true );
+     std::vector< FreemanChain<Z2i::Integer> > contours;
+     RasterContourFollower<Z2i::KSpace>::extractAllFreemanChains
+       ( contours, K, SurfelAdjacency<2>( true ), digitalSet );
+     @endcode
+
+     @tparam TKSpace the type of cellular grid space of dimension 2
+     (e.g. a KhalimskySpaceND).
+
+     @see Surfaces, testRasterContourFollower.cpp
+   */
+  template <typename TKSpace>
+  class RasterContourFollower
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TKSpace KSpace;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Vector Vector;
+    typedef FreemanChain<Integer> Chain;
+    typedef GridCurve<KSpace> Curve;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension == 2 ));
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+       Extracts all the contours of a 2D shape as closed Freeman
+       chains of pointels (the last point of each chain is its first
+       point).
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of the shape. It is called once per point
+       of the bounds of @a aKSpace, possibly from several threads.
+
+       @param aVectChains (modified) the contours.
+       @param aKSpace any space of dimension 2, whose bounds (pixels)
+       delimit the scanned part of the shape.
+       @param aSurfelAdj the surfel adjacency (interior for a
+       4-connected shape, exterior for an 8-connected shape).
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param nbStrips the number of strips followed independently, 0
+       means one strip per available thread.
+    */
+    template <typename PointPredicate>
+    static
+    void extractAllFreemanChains
+    ( std::vector< Chain > & aVectChains,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<2> & aSurfelAdj,
+      const PointPredicate & pp,
+      unsigned int nbStrips = 0 );
+
+    /**
+       Extracts all the contours of a 2D shape as closed grid curves.
+
+       @tparam PointPredicate a model of concepts::CPointPredicate
+       describing the inside of the shape.
+
+       @param aVectCurves (modified) the contours.
+       @param aKSpace any space of dimension 2 (aliased by the curves).
+       @param aSurfelAdj the surfel adjacency (interior for a
+       4-connected shape, exterior for an 8-connected shape).
+       @param pp an instance of a model of concepts::CPointPredicate.
+       @param nbStrips the number of strips followed independently, 0
+       means one strip per available thread.
+
+       @see extractAllFreemanChains
+    */
+    template <typename PointPredicate>
+    static
+    void extractAllGridCurves
+    ( std::vector< Curve > & aVectCurves,
+      const KSpace & aKSpace,
+      const SurfelAdjacency<2> & aSurfelAdj,
+      const PointPredicate & pp,
+      unsigned int nbStrips = 0 );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// Index of a directed linel: 4 times the index of its first
+    /// pointel (in raster order) plus its Freeman code.
+    typedef DGtal::uint64_t LinelKey;
+    typedef std::size_t Index;
+
+    /// The pixels of the scanned bounds.
+    struct Bitmap
+    {
+      /// Number of pixels per row.
+      Index width;
+      /// Number of rows.
+      Index height;
+      /// Pixels, with a one-pixel background frame, row by row.
+      std::vector<unsigned char> pixels;
+      /// 'true' iff the shape is 4-connected (turn left at saddles).
+      bool turnLeft;
+
+      /**
+         @param i the column of a pointel (0 to width).
+         @param j the row of a pointel (0 to height).
+         @return the configuration of the four pixels around pointel
+         (i,j): bit 0 lower-left, bit 1 lower-right, bit 2
+         upper-left, bit 3 upper-right.
+      */
+      unsigned int configuration( Index i, Index j ) const;
+
+      /**
+         @param config a configuration of four pixels.
+         @return the mask of the Freeman codes of the boundary linels
+         leaving the pointel, the shape being on their left.
+      */
+      static unsigned int outgoing( unsigned int config );
+
+      /**
+         @param config a configuration of four pixels.
+         @param in the Freeman code of the linel arriving at the pointel.
+         @return the Freeman code of the next linel.
+      */
+      unsigned int next( unsigned int config, unsigned int in ) const;
+    };
+
+    /// A piece of contour inside a strip.
+    struct Piece
+    {
+      /// Key of the linel through which the piece enters the strip
+      /// (same as exit for a whole contour).
+      LinelKey entry;
+      /// Key of the last linel of the piece.
+      LinelKey exit;
+      /// Smallest linel key of the piece.
+      LinelKey minKey;
+      /// Position of this linel in the codes.
+      Index minPosition;
+      /// Freeman codes of the piece.
+      std::string codes;
+    };
+
+    /**
+       Follows the contours whose linels start in pointel rows
+       [first,last).
+
+       @param bitmap the pixels.
+       @param visited the visited linels of each pointel (one bit per code).
+       @param first the first pointel row of the strip.
+       @param last the row after the strip.
+       @param pieces (returns) the pieces of contours crossing the
+       strip boundaries.
+       @param contours (returns) the contours lying in the strip.
+    */
+    static void followStrip( const Bitmap & bitmap,
+                             std::vector<unsigned char> & visited,
+                             Index first, Index last,
+                             std::vector<Piece> & pieces,
+                             std::vector<Piece> & contours );
+
+    /**
+       Follows a contour from a pointel until the linel @a stop or until
+       it leaves the rows [first,last).
+
+       @param bitmap the pixels.
+       @param visited the visited linels of each pointel.
+       @param first the first pointel row of the strip.
+       @param last the row after the strip.
+       @param i the column of the starting pointel.
+       @param j the row of the starting pointel.
+       @param in the code of the linel arriving at the starting pointel.
+       @param stop the key of the linel ending the contour, if met.
+       @param piece (modified) the piece, whose codes are extended.
+    */
+    static void follow( const Bitmap & bitmap,
+                        std::vector<unsigned char> & visited,
+                        Index first, Index last,
+                        Index i, Index j, unsigned int in,
+                        LinelKey stop, Piece & piece );
+
+  }; // end of class RasterContourFollower
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/helpers/RasterContourFollower.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined RasterContourFollower_h
+
+#undef RasterContourFollower_RECURSES
+#endif // else defined(RasterContourFollower_RECURSES)
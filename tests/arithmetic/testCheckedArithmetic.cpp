@@ -0,0 +1,162 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testCheckedArithmetic.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing CheckedArithmetic.h and the 128-bit integers.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/CheckedArithmetic.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/geometry/curves/ArithmeticalDSL.h"
+#include "DGtal/geometry/curves/ArithmeticalDSS.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DGtal::int64_t I64;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing CheckedArithmetic.h.
+///////////////////////////////////////////////////////////////////////////////
+
+/// A random 64-bit integer, whose magnitude is random too.
+I64 randomInt64()
+{
+  const DGtal::uint64_t r = ( DGtal::uint64_t( rand() ) << 42 )
+    ^ ( DGtal::uint64_t( rand() ) << 21 ) ^ DGtal::uint64_t( rand() );
+  return static_cast<I64>( r >> ( rand() % 64 ) ) * ( rand() % 2 ? 1 : -1 );
+}
+
+TEST_CASE( "Overflow-checked 64-bit operations", "[checkedarithmetic]" )
+{
+  const I64 max = std::numeric_limits<I64>::max();
+  const I64 min = std::numeric_limits<I64>::min();
+  I64 r;
+  REQUIRE( ! functions::addOverflow( max - 1, 1, r ) );
+  REQUIRE( r == max );
+  REQUIRE( functions::addOverflow( max, 1, r ) );
+  REQUIRE( functions::addOverflow( min, -1, r ) );
+  REQUIRE( ! functions::subOverflow( -1, max, r ) );
+  REQUIRE( r == min );
+  REQUIRE( functions::subOverflow( 0, min, r ) );
+  REQUIRE( ! functions::mulOverflow( I64( 1 ) << 31, I64( 1 ) << 31, r ) );
+  REQUIRE( r == ( I64( 1 ) << 62 ) );
+  REQUIRE( functions::mulOverflow( I64( 1 ) << 32, I64( 1 ) << 31, r ) );
+  REQUIRE( functions::mulOverflow( min, -1, r ) );
+  REQUIRE( ! functions::mulOverflow( min, 1, r ) );
+  REQUIRE( ! functions::mulOverflow( 0, min, r ) );
+  REQUIRE( r == 0 );
+}
+
+TEST_CASE( "Lazily promoted products", "[checkedarithmetic]" )
+{
+  const I64 max = std::numeric_limits<I64>::max();
+  const I64 min = std::numeric_limits<I64>::min();
+  REQUIRE( functions::productDifferenceSign( 3, 4, 2, 6 ) == 0 );
+  REQUIRE( functions::productDifferenceSign( 3, 5, 2, 6 ) == 1 );
+  REQUIRE( functions::productDifferenceSign( max, max, max - 1, max ) == 1 );
+  REQUIRE( functions::productDifferenceSign( max, max - 1, max - 1, max ) == 0 );
+  REQUIRE( functions::productDifferenceSign( min, min, max, max ) == 1 );
+  REQUIRE( functions::productDifferenceSign( min, max, max, min ) == 0 );
+  REQUIRE( functions::productDifferenceSign( min, 1, max, max ) == -1 );
+
+  typedef PromotedInteger<I64>::Type Promoted;
+  REQUIRE( functions::productDifference( 3, 5, 2, 6 ) == Promoted( 3 ) );
+#if defined(WITH_INT128) || defined(WITH_BIGINTEGER)
+  REQUIRE( functions::productDifference( max, 2, 1, -2 )
+           == Promoted( max ) * Promoted( 2 ) + Promoted( 2 ) );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 10000; ++i )
+    {
+      const I64 a = randomInt64(), b = randomInt64(), c = randomInt64(), d = randomInt64();
+      const Promoted e = Promoted( a ) * Promoted( b ) - Promoted( c ) * Promoted( d );
+      INFO( a << " " << b << " " << c << " " << d );
+      REQUIRE( functions::productDifferenceSign( a, b, c, d ) == ( e > 0 ? 1 : ( e < 0 ? -1 : 0 ) ) );
+      REQUIRE( functions::productDifference( a, b, c, d ) == e );
+    }
+#endif
+}
+
+#ifdef WITH_INT128
+
+TEST_CASE( "128-bit integers as models of CInteger", "[checkedarithmetic]" )
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int128_t> ));
+  REQUIRE( ( std::is_same< PromotedInteger<I64>::Type, DGtal::int128_t >::value ) );
+
+  IntegerComputer<DGtal::int128_t> ic;
+  const DGtal::int128_t p = DGtal::int128_t( 1000000007 ) * 998244353 * 1000003;
+  const DGtal::int128_t a = p * 17, b = p * 19;
+  REQUIRE( ic.gcd( a, b ) == p );
+  REQUIRE( ic.floorDiv( -a, DGtal::int128_t( 3 ) ) == -( a / 3 ) - 1 );
+  REQUIRE( ic.ceilDiv( a, DGtal::int128_t( 3 ) ) == a / 3 + 1 );
+  IntegerComputer<DGtal::int128_t>::Vector2I v = ic.extendedEuclid( a, b, p );
+  REQUIRE( a * v[ 0 ] + b * v[ 1 ] == p );
+}
+
+#ifdef WITH_BIGINTEGER
+/// Decimal writing of an integer.
+template <typename Integer>
+std::string toString( const Integer & i )
+{
+  std::ostringstream out;
+  out << i;
+  return out.str();
+}
+
+TEST_CASE( "Arithmetical DSS with 128-bit remainders", "[checkedarithmetic]" )
+{
+  // The remainders of points far from the origin do not fit in 64 bits.
+  typedef NaiveDSL<I64, DGtal::int128_t> DSL;
+  typedef ArithmeticalDSS<I64, DGtal::int128_t> DSS;
+  typedef ArithmeticalDSS<I64, DGtal::BigInteger> BigDSS;
+  const DSL dsl( ( I64( 1 ) << 30 ) + 7, ( I64( 1 ) << 31 ) + 3, 0 );
+  const DSL::Point first = dsl.getPoint( I64( 1 ) << 36 );
+  const DSL::Point last  = dsl.getPoint( ( I64( 1 ) << 36 ) + 100000 );
+  const DSS dss( dsl.begin( first ), dsl.end( last ) );
+  const BigDSS bigDss( dsl.begin( first ), dsl.end( last ) );
+  REQUIRE( dss.isValid() );
+  REQUIRE( dss.back() == first );
+  REQUIRE( dss.front() == bigDss.front() );
+  REQUIRE( dss.a() != 0 );
+  REQUIRE( toString( dss.a() ) == toString( bigDss.a() ) );
+  REQUIRE( toString( dss.b() ) == toString( bigDss.b() ) );
+  REQUIRE( toString( dss.mu() ) == toString( bigDss.mu() ) );
+  REQUIRE( toString( dss.omega() ) == toString( bigDss.omega() ) );
+}
+#endif
+
+#endif
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -386,6 +386,9 @@ int main( int, char** )
   typedef SpaceND<2, DGtal::BigInteger> Z2I;
   bool res = testLatticePolytope2D<Z2>()
     && testLatticePolytope2D<Z2I>()
+#ifdef WITH_INT128
+    && testLatticePolytope2D< SpaceND<2, DGtal::int128_t> >()
+#endif
     && exhaustiveTestLatticePolytope2D<Z2>()
     && checkOutputConvexHullBorder<Z2>();
   //&& specificTestLatticePolytope2D<Z2>();
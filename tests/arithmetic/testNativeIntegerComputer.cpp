@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testNativeIntegerComputer.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class NativeIntegerComputer.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/NativeIntegerComputer.h"
+#include "DGtal/arithmetic/LatticePolytope2D.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DGtal::int64_t Integer;
+typedef NativeIntegerComputer<Integer> NIC;
+typedef IntegerComputer<Integer> IC;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class NativeIntegerComputer.
+///////////////////////////////////////////////////////////////////////////////
+
+// The simple services are usable in constant expressions.
+static_assert( NIC::gcd( -12, 18 ) == 6, "constexpr gcd" );
+static_assert( NIC::floorDiv( -7, 2 ) == -4, "constexpr floorDiv" );
+static_assert( NIC::ceilDiv( 7, -2 ) == -3, "constexpr ceilDiv" );
+static_assert( NIC::abs( -5 ) == 5 && NIC::max( 1, 3, 2 ) == 3, "constexpr abs/max" );
+
+TEST_CASE( "Selection of the integer computer", "[nativeintegercomputer]" )
+{
+  REQUIRE( ( boost::is_same< IntegerComputerSelector<DGtal::int32_t>::Type,
+             NativeIntegerComputer<DGtal::int32_t> >::value ) );
+  REQUIRE( ( boost::is_same< IntegerComputerSelector<DGtal::int64_t>::Type,
+             NativeIntegerComputer<DGtal::int64_t> >::value ) );
+#ifdef WITH_BIGINTEGER
+  REQUIRE( ( boost::is_same< IntegerComputerSelector<DGtal::BigInteger>::Type,
+             IntegerComputer<DGtal::BigInteger> >::value ) );
+#endif
+  REQUIRE( ( boost::is_same< LatticePolytope2D< SpaceND<2, Integer> >::MyIntegerComputer,
+             NIC >::value ) );
+}
+
+TEST_CASE( "Same results as IntegerComputer", "[nativeintegercomputer]" )
+{
+  IC ic;
+  NIC nic;
+  srand( 0 );
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      const Integer a = rand() % 20001 - 10000;
+      const Integer b = rand() % 20001 - 10000;
+      // c is nonzero, as required by IntegerComputer::extendedEuclid.
+      const Integer sign = rand() % 2 == 0 ? 1 : -1;
+      const Integer c = sign * ( rand() % 100 + 1 );
+      INFO( a << " " << b << " " << c );
+      REQUIRE( nic.gcd( a, b ) == ic.gcd( a, b ) );
+      Integer g;
+      nic.getGcd( g, a, b );
+      REQUIRE( g == ic.gcd( a, b ) );
+      if ( b == 0 ) continue;
+      REQUIRE( nic.floorDiv( a, b ) == ic.floorDiv( a, b ) );
+      REQUIRE( nic.ceilDiv( a, b ) == ic.ceilDiv( a, b ) );
+      Integer fl1, ce1, fl2, ce2;
+      nic.getFloorCeilDiv( fl1, ce1, a, b );
+      ic.getFloorCeilDiv( fl2, ce2, a, b );
+      REQUIRE( fl1 == fl2 );
+      REQUIRE( ce1 == ce2 );
+      if ( a == 0 ) continue;
+      const Integer cg = c * ic.gcd( a, b );
+      REQUIRE( nic.extendedEuclid( a, b, cg ) == ic.extendedEuclid( a, b, cg ) );
+      IC::Vector2I u( a, b ), v( a, b );
+      nic.reduce( u );
+      ic.reduce( v );
+      REQUIRE( u == v );
+      if ( a < 0 || b < 0 ) continue;
+      std::vector<Integer> q1, q2;
+      REQUIRE( nic.getCFrac( q1, a, b ) == ic.getCFrac( q2, a, b ) );
+      REQUIRE( q1 == q2 );
+      for ( unsigned int k = 0; k < q1.size(); ++k )
+        REQUIRE( nic.convergent( q1, k ) == ic.convergent( q2, k ) );
+    }
+}
+
+TEST_CASE( "Lattice services", "[nativeintegercomputer]" )
+{
+  IC ic;
+  NIC nic;
+  srand( 1 );
+  for ( unsigned int i = 0; i < 5000; ++i )
+    {
+      const IC::Point2I A( rand() % 201 - 100, rand() % 201 - 100 );
+      IC::Vector2I u( rand() % 50 + 1, rand() % 50 + 1 );
+      nic.reduce( u );
+      const IC::Vector2I N( rand() % 50 + 1, rand() % 50 + 1 );
+      const Integer c = N.dot( A ) + rand() % 100;
+      const IC::Vector2I N2( rand() % 50 + 1, rand() % 50 + 1 );
+      const Integer c2 = N2.dot( A ) + rand() % 100;
+      INFO( A << " " << u << " " << N << " " << c << " " << N2 << " " << c2 );
+      Integer fl1, ce1, fl2, ce2;
+      nic.getCoefficientIntersection( fl1, ce1, A, u, N2, c2 );
+      ic.getCoefficientIntersection( fl2, ce2, A, u, N2, c2 );
+      REQUIRE( fl1 == fl2 );
+      REQUIRE( ce1 == ce2 );
+      IC::Vector2I v1, v2;
+      nic.getValidBezout( v1, A, u, N, c, N2, c2 );
+      ic.getValidBezout( v2, A, u, N, c, N2, c2 );
+      REQUIRE( v1 == v2 );
+      IC::Vector3I p( 6 * ( rand() % 10 ), 6 * ( rand() % 10 ), 6 * ( rand() % 10 + 1 ) ), q = p;
+      nic.reduce( p );
+      ic.reduce( q );
+      REQUIRE( p == q );
+      REQUIRE( nic.dotProduct( p, q ) == ic.dotProduct( p, q ) );
+      REQUIRE( nic.crossProduct( u, N ) == ic.crossProduct( u, N ) );
+    }
+}
+
+TEST_CASE( "Half-planes through two points", "[nativeintegercomputer]" )
+{
+  typedef SpaceND<2, Integer> Space;
+  typedef ClosedIntegerHalfPlane<Space> HalfPlane;
+  typedef Space::Point Point;
+  IC ic;
+  const Point A( 1, 2 ), B( 7, 4 ), inP( 0, 5 ), outP( 10, 0 );
+  const HalfPlane h1( A, B, inP, ic );
+  const HalfPlane h2( A, B, inP );
+  REQUIRE( h1.N == h2.N );
+  REQUIRE( h1.c == h2.c );
+  REQUIRE( h1( A ) );
+  REQUIRE( h1( B ) );
+  REQUIRE( h1( inP ) );
+  REQUIRE( ! h1( outP ) );
+  REQUIRE( h1.isOnBoundary( A ) );
+  REQUIRE( h1.isOnBoundary( B ) );
+  REQUIRE( h1.isOnBoundary( Point( 4, 3 ) ) );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
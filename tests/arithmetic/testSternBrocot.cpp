@@ -30,6 +30,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
@@ -861,6 +862,72 @@ testSimplestFractionInBetween()
 
 
 
+/**
+   Concurrent and independent trees.
+*/
+template <typename SB>
+bool
+testConcurrentTrees()
+{
+  typedef typename SB::Integer Integer;
+  typedef typename SB::Fraction Fraction;
+  unsigned int nb = 0;
+  unsigned int nbok = 0;
+
+  trace.beginBlock("Testing block: concurrent and independent trees");
+  const int n = 200;
+  std::vector<Integer> ps( n ), qs( n );
+  srand( 7 );
+  for ( int i = 0; i < n; ++i )
+    {
+      ps[ i ] = 1 + rand() % 1000;
+      qs[ i ] = 1 + rand() % 1000;
+    }
+  IntegerComputer<Integer> ic;
+  SB local;
+  std::vector<Fraction> fs( n ), ls( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      fs[ i ] = SB::fraction( ps[ i ], qs[ i ] );
+      ls[ i ] = local.localFraction( ps[ i ], qs[ i ] );
+    }
+  bool ok = true;
+  for ( int i = 0; i < n; ++i )
+    {
+      const Integer g = ic.gcd( ps[ i ], qs[ i ] );
+      ok = ok && fs[ i ].equals( ps[ i ] / g, qs[ i ] / g )
+        && ls[ i ].equals( ps[ i ] / g, qs[ i ] / g )
+        && fs[ i ] == Fraction( ps[ i ], qs[ i ] )
+        && fs[ i ].right().left().equals( ls[ i ].right().left().p(),
+                                          ls[ i ].right().left().q() )
+        && fs[ i ].inverse().inverse() == fs[ i ];
+    }
+  ++nb; nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") same fractions in both trees" << std::endl;
+  ++nb; nbok += local.localFraction( 1, 0 ) == local.localOneOverZero() ? 1 : 0;
+  ++nb; nbok += local.localFraction( 0, 1 ) == local.localZeroOverOne() ? 1 : 0;
+  ++nb; nbok += local.localZeroOverOne() != SB::zeroOverOne() ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") local 0/1 and 1/0, "
+               << local.nbFractions << " local fractions" << std::endl;
+  // Medians and simplest fractions of local fractions stay local.
+  const typename SB::Quotient nbShared = SB::instance().nbFractions;
+  const Fraction f1 = local.localFraction( 1237, 2000 );
+  const Fraction f2 = local.localFraction( 1238, 2001 );
+  const Fraction m = f1.median( f2 );
+  const Fraction s = f1.simplestFractionInBetween( f2 );
+  ++nb; nbok += m == local.localFraction( m.p(), m.q() ) ? 1 : 0;
+  ++nb; nbok += s == local.localFraction( s.p(), s.q() ) ? 1 : 0;
+  ++nb; nbok += SB::instance().nbFractions == nbShared ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") median " << m.p() << "/" << m.q()
+               << " and simplest " << s.p() << "/" << s.q()
+               << " in the local tree" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -879,7 +946,8 @@ int main( int , char** )
     && testSubStandardDSLQ0<Fraction>()
     && testContinuedFractions<SB>()
     && testAncestors<SB>()
-    && testSimplestFractionInBetween<SB>();
+    && testSimplestFractionInBetween<SB>()
+    && testConcurrentTrees<SB>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
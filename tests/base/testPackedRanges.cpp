@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedRanges.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedRanges.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <sstream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/PackedRanges.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedRanges.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PackedRanges" )
+{
+  typedef PackedRanges< int > Ranges;
+  const std::vector< std::vector< int > > vv = { { 3, 1 }, {}, { 2, 5, 4 }, { 1 } };
+
+  SECTION( "An empty object has no range" )
+    {
+      Ranges ranges;
+      REQUIRE( ranges.isValid() );
+      REQUIRE( ranges.empty() );
+      REQUIRE( ranges.size() == 0 );
+      REQUIRE( ranges.nbValues() == 0 );
+      REQUIRE( ranges.begin() == ranges.end() );
+    }
+
+  SECTION( "Ranges built from a vector of vectors have the same values" )
+    {
+      Ranges ranges( vv.begin(), vv.end() );
+      REQUIRE( ranges.isValid() );
+      REQUIRE( ! ranges.empty() );
+      REQUIRE( ranges.size() == vv.size() );
+      REQUIRE( ranges.nbValues() == 6 );
+      REQUIRE( ranges.offsets() == Ranges::Offsets( { 0, 2, 2, 5, 6 } ) );
+      REQUIRE( ranges.values()  == Ranges::Values( { 3, 1, 2, 5, 4, 1 } ) );
+      for ( std::size_t i = 0; i < vv.size(); ++i )
+        {
+          REQUIRE( ranges[ i ].size() == vv[ i ].size() );
+          REQUIRE( ranges[ i ].empty() == vv[ i ].empty() );
+          REQUIRE( std::vector< int >( ranges[ i ] ) == vv[ i ] );
+          for ( std::size_t j = 0; j < vv[ i ].size(); ++j )
+            REQUIRE( ranges[ i ][ j ] == vv[ i ][ j ] );
+        }
+      REQUIRE( ranges[ 2 ].front() == 2 );
+      REQUIRE( ranges[ 2 ].back()  == 4 );
+      REQUIRE( ranges[ 0 ] != ranges[ 3 ] );
+      REQUIRE( ranges[ 0 ] == ranges[ 0 ] );
+      std::ostringstream ss;
+      ss << ranges;
+      REQUIRE( ! ss.str().empty() );
+    }
+
+  SECTION( "Ranges are visited with random access iterators" )
+    {
+      Ranges ranges( vv.begin(), vv.end() );
+      REQUIRE( ranges.end() - ranges.begin() == 4 );
+      REQUIRE( *( ranges.begin() + 2 ) == ranges[ 2 ] );
+      std::size_t i = 0;
+      for ( auto r : ranges )
+        REQUIRE( std::vector< int >( r.begin(), r.end() ) == vv[ i++ ] );
+      REQUIRE( i == vv.size() );
+      std::vector< int > all;
+      for ( auto it = ranges.end(); it != ranges.begin(); )
+        {
+          --it;
+          all.insert( all.end(), it->cbegin(), it->cend() );
+        }
+      REQUIRE( all == std::vector< int >( { 1, 2, 5, 4, 3, 1 } ) );
+    }
+
+  SECTION( "Ranges can be assigned CSR arrays" )
+    {
+      Ranges ranges( vv.begin(), vv.end() );
+      ranges.assign( Ranges::Offsets( { 0, 0, 3 } ), Ranges::Values( { 7, 8, 9 } ) );
+      REQUIRE( ranges.isValid() );
+      REQUIRE( ranges.size() == 2 );
+      REQUIRE( ranges[ 0 ].empty() );
+      REQUIRE( std::vector< int >( ranges[ 1 ] ) == std::vector< int >( { 7, 8, 9 } ) );
+      Ranges other( Ranges::Offsets( { 0, 0, 3 } ), Ranges::Values( { 7, 8, 9 } ) );
+      REQUIRE( other[ 1 ] == ranges[ 1 ] );
+      ranges.clear();
+      REQUIRE( ranges.isValid() );
+      REQUIRE( ranges.empty() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
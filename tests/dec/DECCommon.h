@@ -184,6 +184,31 @@ test_hodge(int domain_size)
         DGtal::trace.endBlock();
     }
 
+    {
+        DGtal::trace.beginBlock("testing laplace with new sizes");
+
+        typedef typename Calculus::Iterator Iterator;
+        int kk = 0;
+        for (Iterator iter = calculus.begin(), iter_end = calculus.end(); iter!=iter_end; iter++, kk++)
+        {
+            const DGtal::Dimension dim = calculus.myKSpace.uDim(iter->first);
+            if (dim != 0) iter->second.primal_size = 1 + kk%3;
+            if (dim != Calculus::dimensionEmbedded) iter->second.dual_size = 1 + kk%5;
+        }
+
+        const typename Calculus::PrimalIdentity0 primal_laplace = calculus.template laplace<DGtal::PRIMAL>();
+        const typename Calculus::PrimalIdentity0 primal_expected = calculus.template antiderivative<1, DGtal::PRIMAL>() * calculus.template derivative<0, DGtal::PRIMAL>();
+        FATAL_ERROR( (primal_laplace.myContainer - primal_expected.myContainer).norm() < 1e-10 );
+
+        const typename Calculus::DualIdentity0 dual_laplace = calculus.template laplace<DGtal::DUAL>();
+        const typename Calculus::DualIdentity0 dual_expected = calculus.template antiderivative<1, DGtal::DUAL>() * calculus.template derivative<0, DGtal::DUAL>();
+        FATAL_ERROR( (dual_laplace.myContainer - dual_expected.myContainer).norm() < 1e-10 );
+
+        calculus.resetSizes();
+
+        DGtal::trace.endBlock();
+    }
+
     DGtal::trace.beginBlock("testing hodge");
     bool test_result = HodgeTester<Calculus, Calculus::dimensionEmbedded>::test(calculus);
     DGtal::trace.endBlock();
@@ -0,0 +1,113 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testATSolver2D.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Tests of the Ambrosio-Tortorelli solver on digital surfaces.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/helpers/Shortcuts.h"
+#include "DGtal/helpers/ShortcutsGeometry.h"
+#include "DGtal/dec/ATSolver2D.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+
+typedef Z3i::KSpace                  KSpace;
+typedef Shortcuts< KSpace >          SH3;
+typedef ShortcutsGeometry< KSpace >  SHG3;
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+/// Gives access to the factorizations kept by the solver.
+struct TestATSolver2D : public ATSolver2D< KSpace >
+{
+  typedef ATSolver2D< KSpace > Base;
+  using Base::Base;
+  using Base::solver_u2;
+  using Base::solver_v0;
+};
+
+TEST_CASE( "ATSolver2D with conjugate gradients and factorizations" )
+{
+  auto params  = SH3::defaultParameters() | SHG3::defaultParameters();
+  params( "polynomial", "sphere1" )( "gridstep", 0.25 );
+  auto shape   = SH3::makeImplicitShape3D( params );
+  auto K       = SH3::getKSpace( params );
+  auto dshape  = SH3::makeDigitizedImplicitShape3D( shape, params );
+  auto bimage  = SH3::makeBinaryImage( dshape, params );
+  auto surface = SH3::makeDigitalSurface( bimage, K, params );
+  auto surfels = SH3::getSurfelRange( surface, params );
+  auto normals = SHG3::getTrivialNormalVectors( K, surfels );
+  const auto calculus = CalculusFactory::createFromNSCells<2>( surfels.begin(), surfels.end() );
+
+  TestATSolver2D iterative( calculus );
+  TestATSolver2D direct( calculus );
+  direct.iterative_tolerance = 0.0;
+  REQUIRE( iterative.iterative_tolerance == 1e-8 );
+  for ( auto* at : { &iterative, &direct } )
+    {
+      at->initInputVectorFieldU2( normals, surfels.cbegin(), surfels.cend() );
+      at->setUp( 0.1, 0.1 );
+      at->setEpsilon( 1.0 );
+    }
+
+  SECTION( "Both solvers give the same u and v" )
+    {
+      for ( int i = 0; i < 3; ++i )
+        {
+          REQUIRE( iterative.solveOneAlternateStep() );
+          REQUIRE( direct.solveOneAlternateStep() );
+        }
+      auto u_iterative = normals;
+      auto u_direct    = normals;
+      iterative.getOutputVectorFieldU2( u_iterative, surfels.cbegin(), surfels.cend() );
+      direct.getOutputVectorFieldU2( u_direct, surfels.cbegin(), surfels.cend() );
+      double u_error = 0.0;
+      for ( std::size_t i = 0; i < surfels.size(); ++i )
+        u_error = std::max( u_error, ( u_iterative[ i ] - u_direct[ i ] ).norm() );
+      const double v_error = ( iterative.getV0().myContainer
+                               - direct.getV0().myContainer ).lpNorm<Eigen::Infinity>();
+      CAPTURE( u_error );
+      CAPTURE( v_error );
+      REQUIRE( u_error < 1e-5 );
+      REQUIRE( v_error < 1e-5 );
+      // conjugate gradients converged, factorizations were never needed.
+      REQUIRE( iterative.solver_u2.nb_analyses == 0 );
+      REQUIRE( iterative.solver_v0.nb_analyses == 0 );
+    }
+
+  SECTION( "Factorizations reuse the analyzed pattern" )
+    {
+      REQUIRE( direct.solveOneAlternateStep() );
+      REQUIRE( direct.solver_u2.analyzed );
+      REQUIRE( direct.solver_v0.analyzed );
+      REQUIRE( direct.solver_u2.nb_analyses == 1 );
+      REQUIRE( direct.solver_v0.nb_analyses == 1 );
+      REQUIRE( direct.solveOneAlternateStep() );
+      REQUIRE( direct.solver_u2.nb_analyses == 1 );
+      REQUIRE( direct.solver_v0.nb_analyses == 1 );
+    }
+}
@@ -0,0 +1,209 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusMultigrid.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Tests of the geometric multigrid for DEC linear problems.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/math/linalg/EigenSupport.h"
+
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/DiscreteExteriorCalculusMultigrid.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef EigenLinearAlgebraBackend::DenseVector DenseVector;
+typedef EigenLinearAlgebraBackend::SparseMatrix SparseMatrix;
+
+template <typename Multigrid>
+void
+check_levels(const Multigrid& multigrid)
+{
+    REQUIRE( multigrid.isValid() );
+    REQUIRE( multigrid.nbLevels() > 1 );
+    for (std::size_t level=0; level+1<multigrid.nbLevels(); level++)
+    {
+        REQUIRE( multigrid.levelSize(level+1) < multigrid.levelSize(level) );
+        REQUIRE( multigrid.prolongation(level).rows() == multigrid.levelSize(level) );
+        REQUIRE( multigrid.prolongation(level).cols() == multigrid.levelSize(level+1) );
+    }
+}
+
+/**
+ * Solves with BiCGSTAB preconditioned by multigrid.
+ * @return number of iterations.
+ */
+template <typename Multigrid>
+Eigen::Index
+check_solve(const Multigrid& multigrid, const SparseMatrix& matrix)
+{
+    const DenseVector input = DenseVector::Random(matrix.cols());
+    const Eigen::SparseLU<SparseMatrix> direct_solver(matrix);
+    const DenseVector expected = direct_solver.solve(input);
+
+    typename Multigrid::SolverBiCGSTAB solver;
+    solver.preconditioner() = multigrid;
+    solver.setTolerance(1e-10);
+    solver.compute(matrix);
+    REQUIRE( solver.info() == Eigen::Success );
+    const DenseVector solution = solver.solve(input);
+    REQUIRE( solver.info() == Eigen::Success );
+    REQUIRE( (solution - expected).norm() < 1e-7 * expected.norm() );
+
+    return solver.iterations();
+}
+
+TEST_CASE("Multigrid on 2d calculus")
+{
+    typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+
+    const Z2i::Domain domain(Z2i::Point(-40,-40), Z2i::Point(40,40));
+    Z2i::DigitalSet set(domain);
+    for (const Z2i::Point& point : domain)
+        if (point.norm() < 36) set.insert(point);
+
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, true);
+
+    SECTION("primal 0-forms prolongation interpolates constants")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, PRIMAL> Multigrid;
+        const Multigrid multigrid(calculus);
+        check_levels(multigrid);
+        REQUIRE( multigrid.levelSize(0) == calculus.kFormLength(0, PRIMAL) );
+        for (std::size_t level=0; level+1<multigrid.nbLevels(); level++)
+        {
+            const DenseVector ones = DenseVector::Ones(multigrid.levelSize(level+1));
+            const DenseVector prolongated = multigrid.prolongation(level) * ones;
+            REQUIRE( (prolongated.cwiseAbs() - DenseVector::Ones(multigrid.levelSize(level))).norm() < 1e-12 );
+        }
+    }
+
+    SECTION("primal 0-form laplace")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, PRIMAL> Multigrid;
+        Multigrid multigrid(calculus);
+        const Calculus::PrimalIdentity0 problem = calculus.laplace<PRIMAL>() + .01 * calculus.identity<0, PRIMAL>();
+        const Eigen::Index iterations = check_solve(multigrid, problem.myContainer);
+        trace.info() << multigrid << " iterations " << iterations << std::endl;
+        REQUIRE( iterations < 10 );
+    }
+
+    SECTION("dual 0-form laplace")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, DUAL> Multigrid;
+        Multigrid multigrid(calculus);
+        check_levels(multigrid);
+        const Calculus::DualIdentity0 problem = calculus.laplace<DUAL>() + .01 * calculus.identity<0, DUAL>();
+        const Eigen::Index iterations = check_solve(multigrid, problem.myContainer);
+        trace.info() << multigrid << " iterations " << iterations << std::endl;
+        REQUIRE( iterations < 20 );
+    }
+
+    SECTION("primal 1-form laplace")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 1, PRIMAL> Multigrid;
+        Multigrid multigrid(calculus);
+        check_levels(multigrid);
+        // in 2d, antiderivative<2, PRIMAL> is the opposite of the adjoint of derivative<1, PRIMAL>
+        const Calculus::PrimalIdentity1 problem =
+            calculus.derivative<0, PRIMAL>() * calculus.antiderivative<1, PRIMAL>() -
+            calculus.antiderivative<2, PRIMAL>() * calculus.derivative<1, PRIMAL>() +
+            .01 * calculus.identity<1, PRIMAL>();
+        const Eigen::Index iterations = check_solve(multigrid, problem.myContainer);
+        trace.info() << multigrid << " iterations " << iterations << std::endl;
+        REQUIRE( iterations < 20 );
+    }
+
+    SECTION("stand-alone solver and dec solver")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, PRIMAL> Multigrid;
+        const Calculus::PrimalIdentity0 problem = calculus.laplace<PRIMAL>() + .01 * calculus.identity<0, PRIMAL>();
+        const Calculus::PrimalForm0 input(calculus, DenseVector::Random(calculus.kFormLength(0, PRIMAL)));
+        const DenseVector expected = Eigen::SparseLU<SparseMatrix>(problem.myContainer).solve(input.myContainer);
+
+        Multigrid multigrid(calculus);
+        multigrid.compute(problem);
+        REQUIRE( multigrid.info() == Eigen::Success );
+        double previous_error = (multigrid.solve(input).myContainer - expected).norm();
+        for (int nb_cycles=2; nb_cycles<5; nb_cycles++)
+        {
+            multigrid.setNbCycles(nb_cycles);
+            const double error = (multigrid.solve(input).myContainer - expected).norm();
+            REQUIRE( error < previous_error / 2 );
+            previous_error = error;
+        }
+
+        typedef DiscreteExteriorCalculusSolver<Calculus, Multigrid::SolverBiCGSTAB, 0, PRIMAL, 0, PRIMAL> Solver;
+        Solver solver;
+        solver.myLinearAlgebraSolver.preconditioner().init(calculus);
+        solver.myLinearAlgebraSolver.setTolerance(1e-10);
+        solver.compute(problem);
+        const Calculus::PrimalForm0 solution = solver.solve(input);
+        REQUIRE( solver.isValid() );
+        REQUIRE( (solution.myContainer - expected).norm() < 1e-7 * expected.norm() );
+    }
+}
+
+TEST_CASE("Multigrid on 3d calculus")
+{
+    typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+
+    const Z3i::Domain domain(Z3i::Point(-7,-7,-7), Z3i::Point(7,7,7));
+    Z3i::DigitalSet set(domain);
+    for (const Z3i::Point& point : domain)
+        if (point.norm() < 6) set.insert(point);
+
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set, false);
+
+    SECTION("primal 0-form laplace")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 0, PRIMAL> Multigrid;
+        Multigrid multigrid(calculus);
+        check_levels(multigrid);
+        const Calculus::PrimalIdentity0 problem = calculus.laplace<PRIMAL>() + .01 * calculus.identity<0, PRIMAL>();
+        const Eigen::Index iterations = check_solve(multigrid, problem.myContainer);
+        trace.info() << multigrid << " iterations " << iterations << std::endl;
+        REQUIRE( iterations < 20 );
+    }
+
+    SECTION("primal 1-form laplace")
+    {
+        typedef DiscreteExteriorCalculusMultigrid<Calculus, 1, PRIMAL> Multigrid;
+        Multigrid multigrid(calculus);
+        check_levels(multigrid);
+        const Calculus::PrimalIdentity1 problem =
+            calculus.derivative<0, PRIMAL>() * calculus.antiderivative<1, PRIMAL>() +
+            calculus.antiderivative<2, PRIMAL>() * calculus.derivative<1, PRIMAL>() +
+            .01 * calculus.identity<1, PRIMAL>();
+        const Eigen::Index iterations = check_solve(multigrid, problem.myContainer);
+        trace.info() << multigrid << " iterations " << iterations << std::endl;
+        REQUIRE( iterations < 20 );
+    }
+}
@@ -0,0 +1,152 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeLinearOperator.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Tests of matrix-free DEC operators against assembled operators.
+ *
+ * This file is part of the DGtal library.
+ */
+
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/math/linalg/EigenSupport.h"
+
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+
+#include "DGtalCatch.h"
+
+using namespace DGtal;
+
+typedef EigenLinearAlgebraBackend::DenseVector DenseVector;
+
+template <typename Operator, typename MatrixFreeOperator>
+double
+operator_error(const Operator& op, const MatrixFreeOperator& mf_op)
+{
+    REQUIRE( mf_op.rows() == op.myContainer.rows() );
+    REQUIRE( mf_op.cols() == op.myContainer.cols() );
+    const DenseVector input = DenseVector::Random(op.myContainer.cols());
+    DenseVector output;
+    mf_op.apply(input, output);
+    const DenseVector expected = op.myContainer * input;
+    return (output - expected).norm() / std::max(1., expected.norm());
+}
+
+template <typename Calculus>
+void
+test_operators(const Calculus& calculus)
+{
+    typedef typename Calculus::DenseVector DenseVector;
+
+    SECTION("derivatives")
+    {
+        REQUIRE( operator_error(calculus.template derivative<0, PRIMAL>(), calculus.template matrixFreeDerivative<0, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.template derivative<1, PRIMAL>(), calculus.template matrixFreeDerivative<1, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.template derivative<0, DUAL>(), calculus.template matrixFreeDerivative<0, DUAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.template derivative<1, DUAL>(), calculus.template matrixFreeDerivative<1, DUAL>()) < 1e-12 );
+    }
+
+    SECTION("hodges")
+    {
+        REQUIRE( operator_error(calculus.template hodge<0, PRIMAL>(), calculus.template matrixFreeHodge<0, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.template hodge<1, PRIMAL>(), calculus.template matrixFreeHodge<1, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.template hodge<1, DUAL>(), calculus.template matrixFreeHodge<1, DUAL>()) < 1e-12 );
+    }
+
+    SECTION("laplace and compositions")
+    {
+        const typename Calculus::PrimalIdentity0 laplace = calculus.template laplace<PRIMAL>();
+        const auto mf_laplace = calculus.template matrixFreeLaplace<PRIMAL>();
+        REQUIRE( operator_error(laplace, mf_laplace) < 1e-12 );
+        REQUIRE( operator_error(calculus.template laplace<DUAL>(), calculus.template matrixFreeLaplace<DUAL>()) < 1e-12 );
+
+        const typename Calculus::PrimalIdentity0 identity = calculus.template identity<0, PRIMAL>();
+        typedef typename std::decay<decltype(mf_laplace)>::type MatrixFreeLaplace;
+        const MatrixFreeLaplace mf_identity(identity);
+        REQUIRE( operator_error(laplace - 2. * identity, mf_laplace - 2. * mf_identity) < 1e-12 );
+        REQUIRE( operator_error(-laplace + identity, -mf_laplace + mf_identity) < 1e-12 );
+
+        const typename Calculus::PrimalForm0 form(calculus, DenseVector::Random(identity.myContainer.cols()));
+        REQUIRE( ((mf_laplace * form).myContainer - (laplace * form).myContainer).norm() < 1e-10 );
+    }
+
+    SECTION("solve with matrix-free operator")
+    {
+        const typename Calculus::PrimalIdentity0 identity = calculus.template identity<0, PRIMAL>();
+        const typename Calculus::PrimalIdentity0 system = identity + calculus.template laplace<PRIMAL>();
+        typedef typename std::decay<decltype(calculus.template matrixFreeLaplace<PRIMAL>())>::type MatrixFreeLaplace;
+        const MatrixFreeLaplace mf_system = MatrixFreeLaplace(identity) + calculus.template matrixFreeLaplace<PRIMAL>();
+
+        const DenseVector rhs = DenseVector::Random(identity.myContainer.cols());
+        Eigen::SparseLU<typename Calculus::SparseMatrix> direct_solver(system.myContainer);
+        const DenseVector expected = direct_solver.solve(rhs);
+
+        typename MatrixFreeLaplace::SolverBiCGSTAB solver;
+        solver.setTolerance(1e-12);
+        solver.compute(mf_system);
+        const DenseVector solution = solver.solve(rhs);
+        REQUIRE( solver.info() == Eigen::Success );
+        REQUIRE( (solution - expected).norm() < 1e-8 * std::max(1., expected.norm()) );
+    }
+}
+
+TEST_CASE("Matrix-free operators on 2d calculus")
+{
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+    const Z2i::Domain domain(Z2i::Point(0,0), Z2i::Point(9,7));
+    Z2i::DigitalSet set(domain);
+    for (const Z2i::Point& point : domain)
+        if ((point - Z2i::Point(4,4)).norm() < 3.5) set.insert(point);
+
+    SECTION("with border")
+    {
+        test_operators(CalculusFactory::createFromDigitalSet(set, true));
+    }
+
+    SECTION("without border")
+    {
+        test_operators(CalculusFactory::createFromDigitalSet(set, false));
+    }
+}
+
+TEST_CASE("Matrix-free operators on 3d calculus")
+{
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+    const Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(6,6,6));
+    Z3i::DigitalSet set(domain);
+    for (const Z3i::Point& point : domain)
+        if ((point - Z3i::Point(3,3,3)).norm() < 2.5) set.insert(point);
+
+    const auto calculus = CalculusFactory::createFromDigitalSet(set, true);
+    test_operators(calculus);
+
+    SECTION("2-forms")
+    {
+        REQUIRE( operator_error(calculus.derivative<2, PRIMAL>(), calculus.matrixFreeDerivative<2, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.derivative<2, DUAL>(), calculus.matrixFreeDerivative<2, DUAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.hodge<2, PRIMAL>(), calculus.matrixFreeHodge<2, PRIMAL>()) < 1e-12 );
+        REQUIRE( operator_error(calculus.hodge<3, DUAL>(), calculus.matrixFreeHodge<3, DUAL>()) < 1e-12 );
+    }
+}
@@ -89,6 +89,21 @@ public:
     lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(),  back_inserter ( tangent ) );
     return true;
   }
+  bool lambda64Consistency()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST2D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( curve.begin(), curve.end() );
+    std::vector < RealVector > tangent;
+    lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(),  back_inserter ( tangent ) );
+    if ( tangent.size() != curve.size() )
+      return false;
+    for ( unsigned int i = 0; i < curve.size(); i++ )
+      if ( ( tangent[ i ] - lmst64.eval ( curve[ i ] ) ).norm() > 1e-12 )
+        return false;
+    return true;
+  }
 };
 
 
@@ -106,6 +121,9 @@ int main( int , char**  )
         trace.beginBlock ( "Testing calculation for whole curve" );
            res &= testLMST.lambda64();
         trace.endBlock();
+        trace.beginBlock ( "Testing whole curve against point only calculation" );
+           res &= testLMST.lambda64Consistency();
+        trace.endBlock();
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
     return res ? 0 : 1;
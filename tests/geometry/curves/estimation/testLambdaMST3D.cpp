@@ -66,6 +66,12 @@ class testLambdaMST3D
   typedef SaturatedSegmentation<SegmentComputer2D> Segmentation2D;
 private:
   Range curve;
+
+  /// @return 'true' iff the tangents u and v are equal up to orientation.
+  static bool sameLine ( const RealVector & u, const RealVector & v )
+  {
+    return std::min ( ( u - v ).norm(), ( u + v ).norm() ) < 1e-12;
+  }
 public:
   testLambdaMST3D ()
   {
@@ -111,6 +117,61 @@ public:
       return true;
   }
 
+  bool lambda64Consistency()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST3D < Segmentation > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.init ( curve.begin(), curve.end() );
+    vector < RealVector > tangent;
+    lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+    if ( tangent.size() != curve.size() )
+      return false;
+    // The whole curve evaluation orients tangents coherently along the
+    // curve, the point only calculation does not.
+    for ( unsigned int i = 0; i < curve.size(); i++ )
+      if ( ! sameLine ( tangent[ i ], lmst64.eval ( curve[ i ] ) ) )
+        return false;
+    return true;
+  }
+
+  bool lambda64FilteredConsistency()
+  {
+    Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
+    LambdaMST3D < Segmentation, Lambda64Function, DSSLengthLessEqualFilter < SegmentComputer > > lmst64;
+    lmst64.attach ( segmenter );
+    lmst64.getDSSFilter ( ).init ( 3 );
+    lmst64.init ( curve.begin(), curve.end() );
+    vector < RealVector > tangent;
+    lmst64.eval < back_insert_iterator< vector < RealVector > > > ( curve.begin(), curve.end(), back_inserter ( tangent ) );
+    if ( tangent.size() != curve.size() )
+      return false;
+    // Points covered by an unfiltered segment are not orphans, even
+    // when a later segment covering them is filtered out.
+    vector < bool > covered ( curve.size(), false );
+    unsigned int nbFiltered = 0, nbCoveredThenFiltered = 0;
+    for ( Segmentation::SegmentComputerIterator DSS = segmenter.begin(); DSS != segmenter.end(); ++DSS )
+    {
+      const bool filtered = lmst64.getDSSFilter ( ) ( *DSS );
+      nbFiltered += filtered ? 1 : 0;
+      for ( ConstIterator it = DSS.begin(); it != DSS.end(); ++it )
+      {
+        const unsigned int i = std::distance ( curve.cbegin(), it );
+        if ( filtered && covered[ i ] )
+          ++nbCoveredThenFiltered;
+        covered[ i ] = covered[ i ] || ! filtered;
+      }
+    }
+    trace.info() << nbFiltered << " filtered segments, " << nbCoveredThenFiltered
+                 << " covered points in a later filtered segment" << endl;
+    if ( nbFiltered == 0 || nbCoveredThenFiltered == 0 )
+      return false;
+    for ( unsigned int i = 0; i < curve.size(); i++ )
+      if ( covered[ i ] && ! sameLine ( tangent[ i ], lmst64.eval ( curve[ i ] ) ) )
+        return false;
+    return true;
+  }
+
   bool lambdaSinByPoint ()
   {
      Segmentation segmenter ( curve.begin(), curve.end(), SegmentComputer() );
@@ -176,6 +237,10 @@ int main( int , char**  )
            res &= testLMST.lambdaSin();
            res &= testLMST.lambdaExp();
         trace.endBlock();
+        trace.beginBlock ( "Testing whole curve against point only calculation" );
+           res &= testLMST.lambda64Consistency();
+           res &= testLMST.lambda64FilteredConsistency();
+        trace.endBlock();
     trace.endBlock();
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     return res ? 0 : 1;
@@ -0,0 +1,164 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PackedFreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+#include "DGtal/geometry/curves/GridCurve.h"
+#include "ConfigTest.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Checks a packed chain against the points of the Freeman chain.
+void checkAgainstFreemanChain( const FC & fc )
+{
+  const PFC pfc( fc );
+  REQUIRE( pfc.isValid() );
+  REQUIRE( pfc.size() == fc.size() );
+  REQUIRE( pfc.toString() == fc.chain );
+  REQUIRE( pfc.toFreemanChain().chain == fc.chain );
+
+  std::vector<PFC::Point> expected;
+  for ( FC::ConstIterator it = fc.begin(), itEnd = fc.end(); it != itEnd; ++it )
+    expected.push_back( *it );
+  // FreemanChain::ConstIterator visits no point on an empty chain.
+  if ( fc.size() == 0 ) expected.push_back( PFC::Point( fc.x0, fc.y0 ) );
+  std::vector<PFC::Point> points;
+  pfc.decode( points );
+  REQUIRE( points == expected );
+  REQUIRE( pfc.lastPoint() == expected.back() );
+
+  // partial decodings and displacements
+  const PFC::Index n = pfc.size();
+  for ( PFC::Index first : { PFC::Index( 0 ), n / 3, n / 2 } )
+    for ( PFC::Index last : { n / 2, ( 2 * n ) / 3 + 1, n } )
+      if ( first <= last && last <= n )
+        {
+          std::vector<PFC::Point> part;
+          pfc.decode( first, last, std::back_inserter( part ) );
+          REQUIRE( part.size() == last - first + 1 );
+          REQUIRE( std::equal( part.begin(), part.end(), expected.begin() + first ) );
+          REQUIRE( pfc.displacement( first, last ) == expected[ last ] - expected[ first ] );
+        }
+
+  PFC other;
+  other.assignFromPoints( expected.begin(), expected.end() );
+  REQUIRE( other == pfc );
+}
+
+TEST_CASE( "Packed Freeman chain codes", "[packedfreemanchain]" )
+{
+  PFC pfc( "0112223", 3, -2 );
+  REQUIRE( pfc.size() == 7 );
+  REQUIRE( pfc.code( 0 ) == 0 );
+  REQUIRE( pfc.code( 3 ) == 2 );
+  REQUIRE( pfc.code( 6 ) == 3 );
+  REQUIRE( pfc.firstPoint() == PFC::Point( 3, -2 ) );
+  REQUIRE( pfc.lastPoint() == PFC::Point( 1, -1 ) );
+
+  pfc.setCode( 3, 0 );
+  REQUIRE( pfc.toString() == "0110223" );
+  pfc.push_back( 1 );
+  REQUIRE( pfc.toString() == "01102231" );
+  REQUIRE( pfc.lastPoint() == PFC::Point( 5, -1 ) + PFC::Vector( -2, 1 ) );
+
+  // 32 codes per word
+  std::string s( 65, '3' );
+  PFC big( s, 0, 0 );
+  REQUIRE( big.words().size() == 3 );
+  REQUIRE( big.memory() <= 3 * sizeof( PFC::Word ) );
+  REQUIRE( big.lastPoint() == PFC::Point( 0, -65 ) );
+  REQUIRE( big != pfc );
+  big.clear();
+  REQUIRE( big.empty() );
+  REQUIRE( big.lastPoint() == PFC::Point( 0, 0 ) );
+}
+
+TEST_CASE( "Packed Freeman chain decoding", "[packedfreemanchain]" )
+{
+  SECTION( "Empty and short chains" )
+    {
+      checkAgainstFreemanChain( FC( "", 1, 1 ) );
+      checkAgainstFreemanChain( FC( "0", 0, 0 ) );
+      checkAgainstFreemanChain( FC( "0001112223", -4, 7 ) );
+    }
+  SECTION( "Random chains around word boundaries" )
+    {
+      srand( 0 );
+      for ( unsigned int n : { 31u, 32u, 33u, 127u, 4096u, 100001u } )
+        {
+          std::string s( n, '0' );
+          for ( auto & c : s ) c = static_cast<char>( '0' + rand() % 4 );
+          checkAgainstFreemanChain( FC( s, 10, -20 ) );
+        }
+    }
+  SECTION( "Contour read from a file" )
+    {
+      std::fstream fst( ( testPath + "samples/BigBall2.fc" ).c_str(), ios::in );
+      FC fc;
+      FC::read( fst, fc );
+      REQUIRE( fc.size() > 0 );
+      checkAgainstFreemanChain( fc );
+    }
+}
+
+TEST_CASE( "Packed Freeman chain and grid curves", "[packedfreemanchain]" )
+{
+  const PFC square( "00112233", 2, 5 );
+  Z2i::Curve curve;
+  REQUIRE( square.toGridCurve( curve ) );
+  REQUIRE( curve.isClosed() );
+  REQUIRE( curve.size() == 8 );
+
+  PFC back;
+  back.assignFromGridCurve( curve );
+  REQUIRE( back == square );
+
+  std::vector<PFC::Point> jump = { PFC::Point( 0, 0 ), PFC::Point( 1, 1 ) };
+  REQUIRE_THROWS_AS( back.assignFromPoints( jump.begin(), jump.end() ),
+                     ConnectivityException );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
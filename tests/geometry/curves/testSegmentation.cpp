@@ -935,6 +935,90 @@ bool SaturatedSegmentationTest()
   return (compteur == 4295);
 }
 
+/**
+ * Checks that the maximal segments computed by chunks are those
+ * visited by the sequential iterator, for every mode.
+ */
+template <typename Segmentation>
+bool checkMaximalSegments( Segmentation& s )
+{
+  typedef typename Segmentation::SegmentComputer SegmentComputer;
+  typedef typename Segmentation::SegmentComputerIterator SegmentComputerIterator;
+  const std::string modes[] = { "First", "MostCentered", "Last",
+                                "First++", "MostCentered++", "Last++" };
+  bool ok = true;
+  for ( const std::string & mode : modes )
+    {
+      s.setMode( mode );
+      std::vector<SegmentComputer> reference;
+      for ( SegmentComputerIterator i = s.begin(), end = s.end(); i != end; ++i )
+        reference.push_back( *i );
+      for ( unsigned int nbChunks : { 1u, 2u, 3u, 8u, 37u } )
+        {
+          std::vector<SegmentComputer> segments;
+          s.computeMaximalSegments( segments, nbChunks );
+          bool same = ( segments.size() == reference.size() );
+          for ( std::size_t k = 0; same && k < segments.size(); ++k )
+            same = ( segments[ k ].begin() == reference[ k ].begin() )
+              && ( segments[ k ].end() == reference[ k ].end() );
+          if ( ! same )
+            trace.info() << "mode " << mode << ", " << nbChunks << " chunks: "
+                         << segments.size() << " segments instead of "
+                         << reference.size() << endl;
+          ok = ok && same;
+        }
+    }
+  return ok;
+}
+
+/**
+ * Segmentation by chunks
+ */
+bool SaturatedSegmentationChunksTest()
+{
+  typedef int Coordinate;
+  typedef FreemanChain<Coordinate> FC; 
+  typedef PointVector<2,Coordinate> Point; 
+  typedef vector<Point>::const_iterator ConstIterator; 
+  typedef Circulator<ConstIterator> ConstCirculator; 
+
+  std::string filename = testPath + "samples/BigBall2.fc";
+  std::fstream fst;
+  fst.open (filename.c_str(), std::ios::in);
+  FC fc(fst);
+  vector<Point> vPts; 
+  vPts.assign(fc.begin(),fc.end()); 
+
+  trace.beginBlock("saturated Segmentation by chunks");
+  unsigned int nb = 0; 
+  unsigned int nbok = 0; 
+
+  {
+    typedef ArithmeticalDSSComputer<ConstIterator,Coordinate,4> RecognitionAlgorithm;
+    typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+    Segmentation s(vPts.begin(), vPts.end(), RecognitionAlgorithm());
+    ++nb; nbok += checkMaximalSegments( s ) ? 1 : 0; 
+    trace.info() << "(" << nbok << "/" << nb << ") whole range" << endl;
+    s.setSubRange(vPts.begin() + 100, vPts.begin() + 2000);
+    ++nb; nbok += checkMaximalSegments( s ) ? 1 : 0; 
+    trace.info() << "(" << nbok << "/" << nb << ") subrange" << endl;
+  }
+  {
+    typedef ArithmeticalDSSComputer<ConstCirculator,Coordinate,4> RecognitionAlgorithm;
+    typedef SaturatedSegmentation<RecognitionAlgorithm> Segmentation;
+    ConstCirculator c(vPts.begin(), vPts.begin(), vPts.end() ); 
+    Segmentation s(c, c, RecognitionAlgorithm());
+    ++nb; nbok += checkMaximalSegments( s ) ? 1 : 0; 
+    trace.info() << "(" << nbok << "/" << nb << ") whole closed curve" << endl;
+    s.setSubRange(c + 3000, c + 500);
+    ++nb; nbok += checkMaximalSegments( s ) ? 1 : 0; 
+    trace.info() << "(" << nbok << "/" << nb << ") part of the closed curve" << endl;
+  }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
 /////////////////////////////////////////////////////////////////////////
 //////////////// MAIN ///////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////
@@ -951,6 +1035,7 @@ int main(int argc, char **argv)
   bool res = greedySegmentationVisualTest()
 && SaturatedSegmentationVisualTest()
 && SaturatedSegmentationTest()
+&& SaturatedSegmentationChunksTest()
 ;
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -108,6 +108,7 @@ bool checkCOBAGenericStandardPlaneComputer
                    << pts.size() << " points of plane " 
                    << mu << " <= " << a << "*x+" << b << "*y+" << c << "*z+"
                    << " < " << (mu+a+b+c) << std::endl;
+      ++nb; nbok += computer.ic().abs( -diameter ) == diameter ? 1 : 0;
       computer.init( 2*diameter, 1, 1 );
       std::random_shuffle( pts.begin(), pts.end() );
       ++nb; nbok += computer.extend( pts.begin(), pts.end() ) ? 1 : 0;
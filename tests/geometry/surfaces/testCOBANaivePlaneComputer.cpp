@@ -429,6 +429,7 @@ checkExtendWithManyPoints( unsigned int diameter,
       else if ( ( b >= a ) && ( b >= c ) )  axis = 1;
       else                                  axis = 2;
       plane.init( diameter, 1, 1 );
+      ++nb; nbok += plane.ic().abs( -d ) == d ? 1 : 0;
 
       std::vector<Point> pts;
       for ( unsigned int i = 0; i < nbpoints; ++i )
@@ -486,12 +487,16 @@ int main( int /*argc*/, char** /*argv*/ )
   using namespace Z3i;
 
   // Max diameter is ~20 for int32_t, ~500 for int64_t, any with BigInteger.
+  // int128_t goes far beyond int64_t without heap allocation.
   trace.beginBlock ( "Testing class COBANaivePlaneComputer" );
   bool res = true 
     && testCOBANaivePlaneComputer()
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int32_t> >( 20, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int64_t> >( 500, 100, 200 )
     && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::BigInteger> >( 10000, 10, 200 )
+#ifdef WITH_INT128
+    && checkManyPlanes<COBANaivePlaneComputer<Z3, DGtal::int128_t> >( 10000, 100, 200 )
+#endif
     && checkExtendWithManyPoints<COBAGenericNaivePlaneComputer<Z3, DGtal::int64_t> >( 100, 100, 200 );
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
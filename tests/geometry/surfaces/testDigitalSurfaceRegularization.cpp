@@ -201,4 +201,38 @@ TEST_CASE( "Testing DigitalSurfaceRegularization" )
   }
 }
 
+TEST_CASE( "Testing DigitalSurfaceRegularization on a non well-composed surface" )
+{
+  typedef Shortcuts<Z3i::KSpace> SH3;
+  typedef ShortcutsGeometry<Z3i::KSpace> SHG3;
+  auto params = SH3::defaultParameters()
+  | SHG3::defaultParameters();
+  params("verbose", 0);
+  
+  // Two 2x2x3 columns of voxels sharing an edge: the pointels of this
+  // edge are the centers of two faces of the dual surface.
+  Z3i::Domain domain( Z3i::Point( -2, -2, -2 ), Z3i::Point( 6, 6, 5 ) );
+  auto bimage = SH3::makeBinaryImage( domain );
+  for(auto z = 0; z < 3; ++z)
+    for(auto x = 0; x < 2; ++x)
+      for(auto y = 0; y < 2; ++y)
+      {
+        bimage->setValue( Z3i::Point( x, y, z ), true );
+        bimage->setValue( Z3i::Point( x+2, y+2, z ), true );
+      }
+  auto K       = SH3::getKSpace( bimage, params );
+  auto surface = SH3::makeDigitalSurface( bimage, K, params );
+  REQUIRE( surface->size() == 64 );
+  REQUIRE( surface->allClosedFaces().size() == 66 );
+  
+  DigitalSurfaceRegularization<SH3::DigitalSurface> regul(surface);
+  regul.init();
+  regul.attachConvolvedTrivialNormalVectors(params);
+  double energy = regul.computeGradient();
+  REQUIRE( energy == Approx( 72.2772 ) );
+  auto finalenergy = regul.regularize();
+  REQUIRE( finalenergy == Approx( 0.308234 ) );
+  REQUIRE( regul.isValid() );
+}
+
 /** @ingroup Tests **/
@@ -0,0 +1,199 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchConvexHull2D.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class BatchConvexHull2D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/tools/BatchConvexHull2D.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef BatchConvexHull2D<DGtal::int64_t> Batch;
+typedef Batch::Point Point;
+typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+typedef PredicateFromOrientationFunctor2<Functor> Predicate;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchConvexHull2D.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Random sets of 0 to 40 points in a small box (with many
+/// duplicated and collinear points).
+void randomSets( std::vector<DGtal::int64_t> & xs, std::vector<DGtal::int64_t> & ys,
+                 std::vector<Batch::Index> & offsets, unsigned int nbSets )
+{
+  srand( 0 );
+  offsets.assign( 1, 0 );
+  for ( unsigned int k = 0; k < nbSets; ++k )
+    {
+      const int n = rand() % 41;
+      const int w = 1 + rand() % 12;
+      for ( int i = 0; i < n; ++i )
+        {
+          xs.push_back( rand() % w - 3 );
+          ys.push_back( rand() % ( ( k % 5 == 0 ) ? 1 : w ) + 7 );
+        }
+      offsets.push_back( xs.size() );
+    }
+}
+
+/// The hull of Hull2DHelpers, starting from its smallest point
+/// (it returns no point for a single point and repeats the point of
+/// a set of equal points).
+std::vector<Point> referenceHull( const std::vector<Point> & points )
+{
+  Functor functor;
+  std::vector<Point> res;
+  functions::Hull2D::andrewConvexHullAlgorithm( points.begin(), points.end(),
+                                                std::back_inserter( res ), Predicate( functor ) );
+  if ( res.empty() && ! points.empty() ) res.push_back( points.front() );
+  res.erase( std::unique( res.begin(), res.end() ), res.end() );
+  std::rotate( res.begin(), std::min_element( res.begin(), res.end() ), res.end() );
+  return res;
+}
+
+TEST_CASE( "Batch of small convex hulls", "[batchconvexhull]" )
+{
+  std::vector<DGtal::int64_t> xs, ys;
+  std::vector<Batch::Index> offsets;
+  randomSets( xs, ys, offsets, 500 );
+
+  Batch batch;
+  batch.compute( xs, ys, offsets, 1 );
+  REQUIRE( batch.isValid() );
+  REQUIRE( batch.size() == 500 );
+  REQUIRE( batch.nbExactTests() == 0 );
+  std::vector<double> thHV, thE;
+  batch.computeThicknesses( thHV, functions::Hull2D::HorizontalVerticalThickness );
+  batch.computeThicknesses( thE, functions::Hull2D::EuclideanThickness );
+  for ( Batch::Index k = 0; k < batch.size(); ++k )
+    {
+      std::vector<Point> points;
+      for ( Batch::Index i = offsets[ k ]; i < offsets[ k + 1 ]; ++i )
+        points.push_back( Point( xs[ i ], ys[ i ] ) );
+      const std::vector<Point> expected = referenceHull( points );
+      std::vector<Point> h;
+      batch.hull( k, std::back_inserter( h ) );
+      INFO( "set " << k );
+      REQUIRE( h == expected );
+      REQUIRE( batch.hullSize( k ) == expected.size() );
+      if ( expected.size() >= 3 )
+        {
+          REQUIRE( thHV[ k ] == Approx( functions::Hull2D::computeHullThickness
+                                        ( expected.begin(), expected.end(),
+                                          functions::Hull2D::HorizontalVerticalThickness ) ) );
+          REQUIRE( thE[ k ] == Approx( functions::Hull2D::computeHullThickness
+                                       ( expected.begin(), expected.end(),
+                                         functions::Hull2D::EuclideanThickness ) ) );
+          REQUIRE( batch.thickness( k, functions::Hull2D::EuclideanThickness ) == thE[ k ] );
+        }
+      else
+        REQUIRE( thE[ k ] == 0.0 );
+    }
+
+  // The result does not depend on the number of blocks.
+  for ( unsigned int nbBlocks : { 0u, 3u, 64u, 1000u } )
+    {
+      Batch other;
+      other.compute( xs, ys, offsets, nbBlocks );
+      REQUIRE( other.hullOffsets() == batch.hullOffsets() );
+      REQUIRE( other.hullXs() == batch.hullXs() );
+      REQUIRE( other.hullYs() == batch.hullYs() );
+      std::vector<double> th;
+      other.computeThicknesses( th, functions::Hull2D::EuclideanThickness, nbBlocks );
+      REQUIRE( th == thE );
+    }
+}
+
+TEST_CASE( "Batch of convex hulls with large coordinates", "[batchconvexhull]" )
+{
+  std::vector<DGtal::int64_t> xs, ys;
+  std::vector<Batch::Index> offsets;
+  randomSets( xs, ys, offsets, 200 );
+  Batch batch;
+  batch.compute( xs, ys, offsets );
+
+  // A positive scaling and a translation map the hulls to the hulls,
+  // but the orientation tests are no more exact in double precision.
+  const DGtal::int64_t scale = DGtal::int64_t( 1 ) << 30;
+  const DGtal::int64_t shift = DGtal::int64_t( 1 ) << 40;
+  std::vector<DGtal::int64_t> bigXs( xs.size() ), bigYs( ys.size() );
+  for ( std::size_t i = 0; i < xs.size(); ++i )
+    {
+      bigXs[ i ] = xs[ i ] * scale + shift;
+      bigYs[ i ] = ys[ i ] * scale - shift;
+    }
+  Batch big;
+  big.compute( bigXs, bigYs, offsets );
+  REQUIRE( big.nbExactTests() > 0 );
+  REQUIRE( big.hullOffsets() == batch.hullOffsets() );
+  for ( std::size_t i = 0; i < big.hullXs().size(); ++i )
+    {
+      REQUIRE( big.hullXs()[ i ] == batch.hullXs()[ i ] * scale + shift );
+      REQUIRE( big.hullYs()[ i ] == batch.hullYs()[ i ] * scale - shift );
+    }
+}
+
+TEST_CASE( "Degenerate sets", "[batchconvexhull]" )
+{
+  // empty set, one point, twice the same point, a segment with an
+  // inner point, a triangle.
+  const std::vector<DGtal::int64_t> xs = { 4, 1, 1, 0, 2, 1, 0, 3, 0 };
+  const std::vector<DGtal::int64_t> ys = { 5, 1, 1, 0, 2, 1, 0, 0, 3 };
+  const std::vector<Batch::Index> offsets = { 0, 0, 1, 3, 6, 9 };
+  Batch batch;
+  batch.compute( xs, ys, offsets );
+  REQUIRE( batch.size() == 5 );
+  REQUIRE( batch.hullSize( 0 ) == 0 );
+  REQUIRE( batch.hullSize( 1 ) == 1 );
+  REQUIRE( batch.vertex( 1, 0 ) == Point( 4, 5 ) );
+  REQUIRE( batch.hullSize( 2 ) == 1 );
+  REQUIRE( batch.hullSize( 3 ) == 2 );
+  REQUIRE( batch.vertex( 3, 0 ) == Point( 0, 0 ) );
+  REQUIRE( batch.vertex( 3, 1 ) == Point( 2, 2 ) );
+  REQUIRE( batch.hullSize( 4 ) == 3 );
+  REQUIRE( batch.vertex( 4, 1 ) == Point( 3, 0 ) );
+  REQUIRE( batch.thickness( 3, functions::Hull2D::EuclideanThickness ) == 0.0 );
+  REQUIRE( batch.thickness( 4, functions::Hull2D::HorizontalVerticalThickness ) == Approx( 3.0 ) );
+
+  Batch none;
+  none.compute( xs, ys, std::vector<Batch::Index>() );
+  REQUIRE( none.size() == 0 );
+  REQUIRE( none.isValid() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
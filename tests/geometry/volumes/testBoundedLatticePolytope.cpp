@@ -31,6 +31,7 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/geometry/volumes/BoundedLatticePolytope.h"
@@ -313,5 +314,60 @@ SCENARIO( "BoundedLatticePolytope< Z3 > unit tests", "[lattice_polytope][3d]" )
   }
 }
 
+SCENARIO( "BoundedLatticePolytope< Z3 > enumeration by lines", "[lattice_polytope][3d]" )
+{
+  typedef SpaceND<3,int>                   Space;
+  typedef Space::Point                     Point;
+  typedef Space::Integer                   Integer;
+  typedef BoundedLatticePolytope< Space >  Polytope;
+  typedef Polytope::Domain                 Domain;
+
+  // Enumerations that check every point of the domain.
+  auto bruteForce = [] ( const Polytope& P, int type, std::vector<Point>& pts )
+    {
+      pts.clear();
+      for ( const Point & p : P.getDomain() )
+        if ( ( type == 0 && P.isDomainPointInside( p ) )
+             || ( type == 1 && P.isInterior( p ) )
+             || ( type == 2 && P.isBoundary( p ) ) )
+          pts.push_back( p );
+      return Integer( pts.size() );
+    };
+  srand( 0 );
+  GIVEN( "Random simplices, closed or Minkowski summed with strict cells" ) {
+    for ( unsigned int n = 0; n < 40; ++n )
+      {
+        std::vector<Point> V;
+        for ( unsigned int i = 0; i < 4; ++i )
+          V.push_back( Point( rand() % 15 - 7, rand() % 9 - 4, rand() % 21 - 10 ) );
+        Polytope P( V.begin(), V.end() );
+        if ( ! P.isValid() ) continue;
+        if ( n % 3 == 1 ) P += Polytope::RightStrictUnitCell{ 0, 2 };
+        if ( n % 3 == 2 ) P += Polytope::LeftStrictUnitCell{ 1 };
+        CAPTURE( P );
+        std::vector<Point> in, inter, bd, pts;
+        const Integer nb     = bruteForce( P, 0, in );
+        const Integer nb_int = bruteForce( P, 1, inter );
+        const Integer nb_bd  = bruteForce( P, 2, bd );
+        REQUIRE( P.count() == nb );
+        REQUIRE( P.countInterior() == nb_int );
+        REQUIRE( P.countBoundary() == nb_bd );
+        REQUIRE( P.countUpTo( nb + 1 ) == nb );
+        REQUIRE( P.countUpTo( 3 ) == std::min( nb, 3 ) );
+        P.getPoints( pts );
+        REQUIRE( pts == in );
+        P.getInteriorPoints( pts );
+        REQUIRE( pts == inter );
+        P.getBoundaryPoints( pts );
+        REQUIRE( pts == bd );
+        const Point lo( -2, -3, 0 ), hi( 4, 1, 5 );
+        Integer nb_within = 0;
+        for ( const Point & p : in )
+          nb_within += Domain( lo, hi ).isInside( p ) ? 1 : 0;
+        REQUIRE( P.countWithin( lo, hi ) == nb_within );
+      }
+  }
+}
+
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testIncrementalDigitalConvexity.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class IncrementalDigitalConvexity.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/geometry/volumes/DigitalConvexity.h"
+#include "DGtal/geometry/volumes/IncrementalDigitalConvexity.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class IncrementalDigitalConvexity.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "IncrementalDigitalConvexity< Z2 > cell counts", "[incremental_convexity][2d]" )
+{
+  typedef KhalimskySpaceND<2,int>                KSpace;
+  typedef KSpace::Point                          Point;
+  typedef IncrementalDigitalConvexity< KSpace >  IConvexity;
+
+  IConvexity X( Point( -5, -5 ), Point( 5, 5 ) );
+  GIVEN( "Two neighboring points" ) {
+    REQUIRE( X.addPoint( Point( 0, 0 ) ) );
+    REQUIRE( ! X.addPoint( Point( 0, 0 ) ) );
+    REQUIRE( X.addPoint( Point( 1, 0 ) ) );
+    THEN( "They touch 2 pointels, 7 linels and 6 pixels." ) {
+      REQUIRE( X.nbPoints() == 2 );
+      REQUIRE( X.nbCells( 0 ) == 2 );
+      REQUIRE( X.nbCells( 1 ) == 7 );
+      REQUIRE( X.nbCells( 2 ) == 6 );
+      REQUIRE( X.nbCells() == 15 );
+      REQUIRE( X.nbTouchingPoints( Point( 1, 0 ) ) == 2 );
+      REQUIRE( X.nbTouchingPoints( Point( 1, 1 ) ) == 2 );
+      REQUIRE( X.nbTouchingPoints( Point( -1, 0 ) ) == 1 );
+      REQUIRE( X.isValid() );
+    }
+    THEN( "Removing one point leaves the star of the other." ) {
+      REQUIRE( X.removePoint( Point( 1, 0 ) ) );
+      REQUIRE( ! X.removePoint( Point( 1, 0 ) ) );
+      REQUIRE( X.nbCells( 0 ) == 1 );
+      REQUIRE( X.nbCells( 1 ) == 4 );
+      REQUIRE( X.nbCells( 2 ) == 4 );
+      REQUIRE( X.nbTouchingPoints( Point( 1, 0 ) ) == 1 );
+      REQUIRE( X.nbTouchingPoints( Point( 3, 0 ) ) == 0 );
+      REQUIRE( X.isValid() );
+    }
+  }
+}
+
+SCENARIO( "IncrementalDigitalConvexity< Z3 > agrees with DigitalConvexity", "[incremental_convexity][3d]" )
+{
+  typedef KhalimskySpaceND<3,int>                KSpace;
+  typedef KSpace::Point                          Point;
+  typedef DigitalConvexity< KSpace >             DConvexity;
+  typedef IncrementalDigitalConvexity< KSpace >  IConvexity;
+
+  DConvexity dconv( Point( -1, -1, -1 ), Point( 10, 10, 10 ) );
+  IConvexity X( dconv.space() );
+  srand( 0 );
+  WHEN( "Checking many lattice tetrahedra in domain (0,0,0)-(4,4,4)." ) {
+    unsigned int nbsimplex = 0;
+    unsigned int nbok      = 0;
+    unsigned int nbf       = 0;
+    for ( unsigned int i = 0; i < 200; ++i )
+      {
+        Point a( rand() % 5, rand() % 5, rand() % 5 );
+        Point b( rand() % 5, rand() % 5, rand() % 5 );
+        Point c( rand() % 5, rand() % 5, rand() % 5 );
+        Point d( rand() % 5, rand() % 5, rand() % 5 );
+        if ( ! dconv.isSimplexFullDimensional( { a, b, c, d } ) ) continue;
+        auto tetra = dconv.makeSimplex( { a, b, c, d } );
+        auto S     = dconv.insidePoints( tetra );
+        X.clear();
+        X.addPoints( S.cbegin(), S.cend() );
+        bool same = X.isValid();
+        for ( Dimension k = 1; k <= 3; ++k )
+          same = same && ( X.isKConvex( tetra, k ) == dconv.isKConvex( tetra, k ) );
+        bool cvxf = dconv.isFullyConvex( tetra );
+        same = same && ( X.isFullyConvex( tetra ) == cvxf );
+        nbsimplex += 1;
+        nbok      += same ? 1 : 0;
+        nbf       += cvxf ? 1 : 0;
+      }
+    THEN( "Both checks give the same answers." ) {
+      REQUIRE( nbsimplex > 0 );
+      REQUIRE( nbf > 0 );
+      REQUIRE( nbf < nbsimplex );
+      REQUIRE( nbok == nbsimplex );
+    }
+  }
+  WHEN( "Checking many rational tetrahedra." ) {
+    unsigned int nbsimplex = 0;
+    unsigned int nbok      = 0;
+    for ( unsigned int i = 0; i < 100; ++i )
+      {
+        Point a( 2*(rand() % 10), rand() % 20, 2*(rand() % 10) );
+        Point b( rand() % 20, 2*(rand() % 10), 2*(rand() % 10) );
+        Point c( 2*(rand() % 10), 2*(rand() % 10), rand() % 20 );
+        Point d( 2*(rand() % 10), 2*(rand() % 10), 2*(rand() % 10) );
+        if ( ! dconv.isSimplexFullDimensional( { a, b, c, d } ) ) continue;
+        auto tetra = dconv.makeRationalSimplex( { Point(2,2,2), a, b, c, d } );
+        auto S     = dconv.insidePoints( tetra );
+        X.clear();
+        X.addPoints( S.cbegin(), S.cend() );
+        bool same = X.isFullyConvex( tetra ) == dconv.isFullyConvex( tetra );
+        nbsimplex += 1;
+        nbok      += same ? 1 : 0;
+      }
+    THEN( "Both checks give the same answers." ) {
+      REQUIRE( nbsimplex > 0 );
+      REQUIRE( nbok == nbsimplex );
+    }
+  }
+  WHEN( "Removing and adding back the points of a fully convex tetrahedron." ) {
+    auto tetra = dconv.makeSimplex( { Point( 0, 0, 0 ), Point( 1, 0, 0 ),
+                                      Point( 0, 1, 0 ), Point( 0, 0, 1 ) } );
+    auto S     = dconv.insidePoints( tetra );
+    X.addPoints( S.cbegin(), S.cend() );
+    const std::vector< std::size_t > nb { X.nbCells( 0 ), X.nbCells( 1 ),
+                                          X.nbCells( 2 ), X.nbCells( 3 ) };
+    REQUIRE( X.isFullyConvex( tetra ) );
+    X.removePoint( S.back() );
+    bool cvx_removed = X.isFullyConvex( tetra );
+    X.addPoint( Point( 1, 1, 1 ) );
+    bool cvx_added = X.isFullyConvex( tetra );
+    X.removePoint( Point( 1, 1, 1 ) );
+    X.addPoint( S.back() );
+    THEN( "The set is no longer the tetrahedron, then again is, with the same cells." ) {
+      REQUIRE( ! cvx_removed );
+      REQUIRE( ! cvx_added );
+      REQUIRE( X.isFullyConvex( tetra ) );
+      REQUIRE( X.nbPoints() == S.size() );
+      REQUIRE( X.nbCells( 0 ) == nb[ 0 ] );
+      REQUIRE( X.nbCells( 1 ) == nb[ 1 ] );
+      REQUIRE( X.nbCells( 2 ) == nb[ 2 ] );
+      REQUIRE( X.nbCells( 3 ) == nb[ 3 ] );
+      REQUIRE( X.isValid() );
+    }
+  }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
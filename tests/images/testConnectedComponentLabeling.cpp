@@ -0,0 +1,175 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConnectedComponentLabeling.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ConnectedComponentLabeling.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConnectedComponentLabeling.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConnectedComponentLabeling.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Checks the labeling of a binary image against the components
+ * computed by Object::writeComponents, for several numbers of slabs.
+ */
+template <typename TObject, typename TImage>
+void checkAgainstObject( const typename TObject::DigitalTopology & dt,
+                         const TImage & image, Dimension maxNorm1 )
+{
+  typedef typename TImage::Domain Domain;
+  typedef typename TImage::Value Value;
+  typedef ConnectedComponentLabeling<Domain, Value> Labeling;
+  typedef typename Labeling::Label Label;
+
+  typename TObject::DigitalSet set( image.domain() );
+  for ( auto && p : image.domain() )
+    if ( image( p ) != 0 ) set.insertNew( p );
+  TObject object( dt, set );
+  std::vector<TObject> components;
+  std::back_insert_iterator< std::vector<TObject> > it( components );
+  object.writeComponents( it );
+
+  Labeling reference( image, maxNorm1, 0, 1 );
+  REQUIRE( reference.isValid() );
+  REQUIRE( reference.numberOfComponents() == components.size() );
+  REQUIRE( reference.statistics( 0 ).size == image.domain().size() - set.size() );
+  for ( auto && component : components )
+    {
+      const Label l = reference.labelImage()( *component.pointSet().begin() );
+      REQUIRE( l != 0 );
+      const auto & stats = reference.statistics( l );
+      REQUIRE( stats.size == component.size() );
+      auto lower = *component.pointSet().begin();
+      auto upper = lower;
+      for ( auto && p : component.pointSet() )
+        {
+          REQUIRE( reference.labelImage()( p ) == l );
+          lower = lower.inf( p );
+          upper = upper.sup( p );
+        }
+      REQUIRE( stats.lower == lower );
+      REQUIRE( stats.upper == upper );
+    }
+
+  for ( unsigned int nbSlabs : { 2u, 3u, 7u, 100u } )
+    {
+      Labeling labeling( image, maxNorm1, 0, nbSlabs );
+      REQUIRE( labeling.numberOfComponents() == reference.numberOfComponents() );
+      REQUIRE( std::equal( labeling.labelImage().begin(), labeling.labelImage().end(),
+                           reference.labelImage().begin() ) );
+    }
+}
+
+TEST_CASE( "Connected component labeling of 2D binary images", "[labeling]" )
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> Image;
+  const Z2i::Domain domain( Z2i::Point( -5, 3 ), Z2i::Point( 40, 31 ) );
+  Image image( domain );
+  srand( 0 );
+  for ( auto && p : domain )
+    image.setValue( p, ( rand() % 100 ) < 45 ? 1 : 0 );
+
+  SECTION( "4-adjacency is the one of Object4_8" )
+    {
+      checkAgainstObject<Z2i::Object4_8>( Z2i::dt4_8, image, 1 );
+    }
+  SECTION( "8-adjacency is the one of Object8_4" )
+    {
+      checkAgainstObject<Z2i::Object8_4>( Z2i::dt8_4, image, 2 );
+    }
+}
+
+TEST_CASE( "Connected component labeling of 3D binary images", "[labeling]" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> Image;
+  const Z3i::Domain domain( Z3i::Point( 0, -2, 1 ), Z3i::Point( 13, 9, 17 ) );
+  Image image( domain );
+  srand( 1 );
+  for ( auto && p : domain )
+    image.setValue( p, ( rand() % 100 ) < 25 ? 1 : 0 );
+
+  SECTION( "6-adjacency is the one of Object6_18" )
+    {
+      checkAgainstObject<Z3i::Object6_18>( Z3i::dt6_18, image, 1 );
+    }
+  SECTION( "18-adjacency is the one of Object18_6" )
+    {
+      checkAgainstObject<Z3i::Object18_6>( Z3i::dt18_6, image, 2 );
+    }
+  SECTION( "26-adjacency is the one of Object26_6" )
+    {
+      checkAgainstObject<Z3i::Object26_6>( Z3i::dt26_6, image, 3 );
+    }
+}
+
+TEST_CASE( "Connected component labeling of label images", "[labeling]" )
+{
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+  typedef ConnectedComponentLabeling<Z2i::Domain, int> Labeling;
+  const Z2i::Domain domain( Z2i::Point( 0, 0 ), Z2i::Point( 9, 4 ) );
+  Image image( domain );
+  std::fill( image.begin(), image.end(), -1 );
+  // Two touching rectangles with different values, and a third
+  // rectangle with the same value as the first one.
+  for ( auto && p : domain )
+    {
+      if ( p[ 0 ] < 3 && p[ 1 ] < 3 )       image.setValue( p, 1 );
+      else if ( p[ 0 ] < 6 && p[ 1 ] < 3 )  image.setValue( p, 2 );
+      else if ( p[ 0 ] >= 7 )               image.setValue( p, 1 );
+    }
+
+  Labeling labeling( image, 2, -1 );
+  REQUIRE( labeling.numberOfComponents() == 3 );
+  REQUIRE( labeling.labelImage()( Z2i::Point( 0, 0 ) ) == 1 );
+  REQUIRE( labeling.labelImage()( Z2i::Point( 3, 0 ) ) == 2 );
+  REQUIRE( labeling.labelImage()( Z2i::Point( 7, 0 ) ) == 3 );
+  REQUIRE( labeling.labelImage()( Z2i::Point( 6, 4 ) ) == 0 );
+  REQUIRE( labeling.statistics( 1 ).size == 9 );
+  REQUIRE( labeling.statistics( 1 ).value == 1 );
+  REQUIRE( labeling.statistics( 2 ).value == 2 );
+  REQUIRE( labeling.statistics( 3 ).size == 15 );
+  REQUIRE( labeling.statistics( 3 ).lower == Z2i::Point( 7, 0 ) );
+  REQUIRE( labeling.statistics( 3 ).upper == Z2i::Point( 9, 4 ) );
+  REQUIRE( labeling.statistics( 0 ).size == 50 - 9 - 9 - 15 );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
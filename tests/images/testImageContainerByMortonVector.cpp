@@ -0,0 +1,149 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMortonVector.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class ImageContainerByMortonVector and the
+ * Z-order traversal of HyperRectDomain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMortonVector.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMortonVector.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "HyperRectDomain Z-order traversal", "[morton][domain]" )
+{
+  typedef SpaceND<3>               Space;
+  typedef HyperRectDomain<Space>   Domain;
+  typedef Space::Point             Point;
+  typedef Linearizer<Domain, MortonStorage> MortonLinearizer;
+
+  SECTION( "The Z-order range visits each point once, by increasing Morton index" )
+    {
+      const Domain domain( Point( -3, 2, 5 ), Point( 9, 4, 22 ) );
+      std::set<Point> visited;
+      std::size_t previous = 0;
+      bool first = true;
+      bool increasing = true;
+      for ( auto && p : domain.mortonRange() )
+        {
+          REQUIRE( domain.isInside( p ) );
+          visited.insert( p );
+          const std::size_t index = MortonLinearizer::getIndex( p, domain );
+          increasing = increasing && ( first || previous < index );
+          previous = index;
+          first = false;
+        }
+      REQUIRE( increasing );
+      REQUIRE( visited.size() == domain.size() );
+    }
+
+  SECTION( "The Z-order range of a single line domain" )
+    {
+      const Domain domain( Point( 0, 0, 0 ), Point( 0, 0, 100 ) );
+      std::size_t nb = 0;
+      for ( auto && p : domain.mortonRange() )
+        REQUIRE( p[ 2 ] == (int) nb++ );
+      REQUIRE( nb == domain.size() );
+    }
+
+  SECTION( "The Z-order range of an empty domain is empty" )
+    {
+      const Domain domain( Point( 1, 1, 1 ), Point( 0, 0, 0 ) );
+      REQUIRE( domain.mortonRange().begin() == domain.mortonRange().end() );
+    }
+}
+
+TEST_CASE( "ImageContainerByMortonVector 3D", "[morton][image]" )
+{
+  typedef SpaceND<3>               Space;
+  typedef HyperRectDomain<Space>   Domain;
+  typedef Space::Point             Point;
+  typedef ImageContainerByMortonVector<Domain, int>   MortonImage;
+  typedef ImageContainerBySTLVector<Domain, int>      VectorImage;
+
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< MortonImage > ));
+
+  const Domain domain( Point( -2, 3, 1 ), Point( 12, 9, 20 ) );
+  MortonImage image( domain );
+  VectorImage refImage( domain );
+
+  int i = 0;
+  for ( auto && p : domain )
+    {
+      image.setValue( p, i );
+      refImage.setValue( p, i );
+      ++i;
+    }
+
+  SECTION( "Values are the ones of a row-major image" )
+    {
+      for ( auto && p : domain )
+        REQUIRE( image( p ) == refImage( p ) );
+    }
+
+  SECTION( "Linearization follows the Z-order linearizer" )
+    {
+      REQUIRE( image.storageSize() == Linearizer<Domain, MortonStorage>::getSize( domain ) );
+      for ( auto && p : domain.mortonRange() )
+        REQUIRE( image.linearized( p ) == Linearizer<Domain, MortonStorage>::getIndex( p, domain ) );
+    }
+
+  SECTION( "Ranges follow the domain order" )
+    {
+      REQUIRE( std::equal( image.constRange().begin(), image.constRange().end(),
+                           refImage.constRange().begin() ) );
+      std::fill( refImage.range().begin(), refImage.range().end(), 0 );
+      std::copy( refImage.constRange().begin(), refImage.constRange().end(),
+                 image.range().outputIterator() );
+      for ( auto && p : domain )
+        REQUIRE( image( p ) == 0 );
+    }
+
+  SECTION( "Domain translation" )
+    {
+      image.translateDomain( Point( 1, 1, 1 ) );
+      REQUIRE( image( Point( -1, 4, 2 ) ) == refImage( Point( -2, 3, 1 ) ) );
+      REQUIRE( image( Point( 13, 10, 21 ) ) == refImage( Point( 12, 9, 20 ) ) );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
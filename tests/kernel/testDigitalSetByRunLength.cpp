@@ -0,0 +1,186 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class DigitalSetByRunLength.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRunLength.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/base/SetFunctions.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByRunLength.
+///////////////////////////////////////////////////////////////////////////////
+
+SCENARIO( "DigitalSetByRunLength unit tests", "[runlength]" )
+{
+  typedef Z3i::Point  Point;
+  typedef Z3i::Domain Domain;
+  typedef DigitalSetByRunLength< Domain > RLESet;
+  typedef std::set< Point > RefSet;
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSet< RLESet > ));
+
+  const Domain domain( Point( -8, -8, -8 ), Point( 8, 8, 8 ) );
+  RLESet ball( domain ), cube( domain );
+  RefSet ref_ball, ref_cube;
+  for ( auto p : domain )
+    {
+      if ( p.squaredNorm() <= 36 ) { ball.insert( p ); ref_ball.insert( p ); }
+      if ( p.normInfinity() <= 3 && p[ 0 ] != 0 )
+        { cube.insertNew( p ); ref_cube.insert( p ); }
+    }
+
+  GIVEN( "A ball and a cube with a hole, inserted point by point" ) {
+    THEN( "Sizes, runs and iteration order are consistent" ) {
+      REQUIRE( ball.isValid() );
+      REQUIRE( cube.isValid() );
+      REQUIRE( ball.size() == ref_ball.size() );
+      REQUIRE( cube.size() == ref_cube.size() );
+      REQUIRE( ball.numberOfRuns() == ball.rows().size() );
+      REQUIRE( cube.numberOfRuns() == 2 * cube.rows().size() );
+      std::vector< Point > pts( ball.begin(), ball.end() );
+      std::vector< Point > dom_order;
+      for ( auto p : domain ) if ( ref_ball.count( p ) ) dom_order.push_back( p );
+      REQUIRE( pts == dom_order );
+    }
+    THEN( "Membership agrees with std::set" ) {
+      unsigned int nb_ok = 0;
+      for ( auto p : domain )
+        nb_ok += ( ball( p ) == ( ref_ball.count( p ) == 1 ) ) ? 1 : 0;
+      REQUIRE( nb_ok == domain.size() );
+      REQUIRE( ball.find( Point( 6, 0, 0 ) ) != ball.end() );
+      REQUIRE( *ball.find( Point( 6, 0, 0 ) ) == Point( 6, 0, 0 ) );
+      REQUIRE( ball.find( Point( 7, 0, 0 ) ) == ball.end() );
+    }
+    THEN( "Bounding box is correct" ) {
+      Point lo, up;
+      ball.computeBoundingBox( lo, up );
+      REQUIRE( lo == Point( -6, -6, -6 ) );
+      REQUIRE( up == Point(  6,  6,  6 ) );
+    }
+  }
+
+  GIVEN( "Runs inserted and erased" ) {
+    RLESet S( domain );
+    S.insertRun( Point( 0, 1, 2 ), -5, -2 );
+    S.insertRun( Point( 0, 1, 2 ), 2, 5 );
+    THEN( "Disjoint runs are kept separate" ) {
+      REQUIRE( S.size() == 8 );
+      REQUIRE( S.numberOfRuns() == 2 );
+    }
+    S.insertRun( Point( 0, 1, 2 ), -1, 1 );
+    THEN( "Adjacent runs are merged" ) {
+      REQUIRE( S.size() == 11 );
+      REQUIRE( S.numberOfRuns() == 1 );
+      REQUIRE( S.isValid() );
+    }
+    THEN( "Erasing splits runs" ) {
+      REQUIRE( S.eraseRun( Point( 0, 1, 2 ), -1, 0 ) == 2 );
+      REQUIRE( S.numberOfRuns() == 2 );
+      REQUIRE( S.erase( Point( 0, 1, 2 ) ) == 0 );
+      REQUIRE( S.erase( Point( 3, 1, 2 ) ) == 1 );
+      REQUIRE( S.numberOfRuns() == 3 );
+      REQUIRE( S.size() == 8 );
+      REQUIRE( S.eraseRun( Point( 0, 1, 2 ), -8, 8 ) == 8 );
+      REQUIRE( S.empty() );
+      REQUIRE( S.rows().empty() );
+      REQUIRE( S.isValid() );
+    }
+  }
+
+  GIVEN( "Set operations through SetFunctions" ) {
+    using namespace functions::setops;
+    RefSet ref_union, ref_inter, ref_diff, ref_sym;
+    std::set_union( ref_ball.begin(), ref_ball.end(), ref_cube.begin(), ref_cube.end(),
+                    std::inserter( ref_union, ref_union.end() ) );
+    std::set_intersection( ref_ball.begin(), ref_ball.end(), ref_cube.begin(), ref_cube.end(),
+                           std::inserter( ref_inter, ref_inter.end() ) );
+    std::set_difference( ref_ball.begin(), ref_ball.end(), ref_cube.begin(), ref_cube.end(),
+                         std::inserter( ref_diff, ref_diff.end() ) );
+    std::set_symmetric_difference( ref_ball.begin(), ref_ball.end(),
+                                   ref_cube.begin(), ref_cube.end(),
+                                   std::inserter( ref_sym, ref_sym.end() ) );
+    const RLESet U = ball | cube;
+    const RLESet I = ball & cube;
+    const RLESet D = ball - cube;
+    const RLESet X = ball ^ cube;
+    THEN( "Results are valid and equal to the point-wise ones" ) {
+      REQUIRE( U.isValid() );
+      REQUIRE( I.isValid() );
+      REQUIRE( D.isValid() );
+      REQUIRE( X.isValid() );
+      REQUIRE( RefSet( U.begin(), U.end() ) == ref_union );
+      REQUIRE( RefSet( I.begin(), I.end() ) == ref_inter );
+      REQUIRE( RefSet( D.begin(), D.end() ) == ref_diff );
+      REQUIRE( RefSet( X.begin(), X.end() ) == ref_sym );
+    }
+    THEN( "Inclusion and equality are computed on runs" ) {
+      REQUIRE( functions::isSubset( I, ball ) );
+      REQUIRE( functions::isSubset( cube, U ) );
+      REQUIRE( ! functions::isSubset( ball, cube ) );
+      REQUIRE( functions::isEqual( ( D | I ), ball ) );
+      REQUIRE( ! functions::isEqual( ball, cube ) );
+    }
+  }
+
+  GIVEN( "Complement and conversion to and from images" ) {
+    using namespace functions::setops;
+    RLESet C( domain );
+    C.assignFromComplement( ball );
+    THEN( "The complement has the right size and no common point" ) {
+      REQUIRE( C.isValid() );
+      REQUIRE( C.size() + ball.size() == domain.size() );
+      RLESet I( C );
+      I.assignIntersection( ball );
+      REQUIRE( I.empty() );
+    }
+    THEN( "A set can be written to and read from an image" ) {
+      typedef ImageContainerBySTLVector< Domain, int > Image;
+      Image image( domain );
+      ball.fillImage( image, 2 );
+      cube.fillImage( image, 1 );
+      RLESet S( domain );
+      S.assignFromImage( image, 0, 2 );
+      REQUIRE( S == ( ball | cube ) );
+      S.assignFromImage( image, 1, 2 );
+      REQUIRE( S == ( ball - cube ) );
+    }
+  }
+}
+
+/** @ingroup Tests **/
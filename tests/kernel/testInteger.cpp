@@ -51,6 +51,9 @@ bool testInteger()
   trace.beginBlock ( "Checking CInteger models ..." );
   BOOST_CONCEPT_ASSERT(( concepts::CInteger<int> ));
   BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int16_t> ));
+#ifdef WITH_INT128
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<DGtal::int128_t> ));
+#endif
 
   trace.info() << "  - max int16 = " << NumberTraits<DGtal::int16_t>::max()
          << std::endl;
@@ -32,6 +32,7 @@
 
 #include <cstddef>
 #include <cmath>
+#include <vector>
 
 #include "DGtalCatch.h"
 
@@ -324,6 +325,71 @@ TEST_CASE( "Benchmarking Linearizer in dimension " #N " with " #ORDER, "[.bench]
   REQUIRE( sum > 0 );\
 }
 
+#define TEST_MORTON_LINEARIZER( N ) \
+TEST_CASE( "Testing Linearizer in dimension " #N " with MortonStorage", "[test][dim" #N "][MortonStorage]" )\
+{\
+\
+  typedef SpaceND<N>              Space;\
+  typedef HyperRectDomain<Space>  Domain;\
+  typedef Space::Point   Point;\
+\
+  typedef Linearizer<Domain, MortonStorage>   NewLinearizer;\
+\
+  std::size_t size = 1e3;\
+\
+  Point lowerBound;\
+  for ( std::size_t i = 0 ; i < N ; ++i )\
+    lowerBound[i] = 1 + 7*i;\
+\
+  std::size_t dim_size = std::size_t( std::pow( double(size), 1./N ) + 0.5 );\
+  Point upperBound;\
+  for ( std::size_t i = 0; i < N ; ++i )\
+    upperBound[i] = lowerBound[i] + dim_size + i;\
+\
+  Domain domain( lowerBound, upperBound );\
+  Point extent = upperBound - lowerBound + Point::diagonal(1);\
+  const std::size_t storageSize = NewLinearizer::getSize( domain );\
+\
+  SECTION( "Testing that indices are unique, bounded and consistent between syntaxes" )\
+    {\
+      std::vector<bool> used( storageSize, false );\
+      for ( Domain::ConstIterator it = domain.begin(), it_end = domain.end(); it != it_end ; ++it )\
+        {\
+          const std::size_t i = NewLinearizer::getIndex( *it, lowerBound, extent );\
+          REQUIRE( i < storageSize );\
+          REQUIRE( ! used[ i ] );\
+          used[ i ] = true;\
+          REQUIRE( i == NewLinearizer::getIndex( *it - lowerBound, extent ) );\
+          REQUIRE( i == NewLinearizer::getIndex( *it, domain ) );\
+        }\
+      REQUIRE( storageSize >= domain.size() );\
+    }\
+\
+  SECTION( "Testing getPoint as the inverse of getIndex" )\
+    {\
+      for ( Domain::ConstIterator it = domain.begin(), it_end = domain.end(); it != it_end ; ++it )\
+        {\
+          const std::size_t i = NewLinearizer::getIndex( *it, domain );\
+          REQUIRE( NewLinearizer::getPoint( i, lowerBound, extent ) == *it );\
+          REQUIRE( NewLinearizer::getPoint( i, extent ) + lowerBound == *it );\
+          REQUIRE( NewLinearizer::getPoint( i, domain ) == *it );\
+        }\
+    }\
+}
+
+TEST_CASE( "Testing Morton linearization example in dimension 2", "[test][dim2][MortonStorage]" )
+{
+  typedef SpaceND<2>              Space;
+  typedef HyperRectDomain<Space>  Domain;
+  typedef Space::Point            Point;
+  typedef Linearizer<Domain, MortonStorage> MortonLinearizer;
+
+  const Domain domain( Point(0, 1), Point(4, 3) );
+  REQUIRE( MortonLinearizer::getIndex( Point(2, 2), domain ) == 6 );
+  REQUIRE( MortonLinearizer::getPoint( 6, domain ) == Point(2, 2) );
+  REQUIRE( MortonLinearizer::getSize( domain ) == 25 );
+}
+
 TEST_LINEARIZER( 1, ColMajorStorage )
 TEST_LINEARIZER( 2, ColMajorStorage )
 TEST_LINEARIZER( 3, ColMajorStorage )
@@ -336,6 +402,11 @@ TEST_LINEARIZER( 3, RowMajorStorage )
 TEST_LINEARIZER( 4, RowMajorStorage )
 TEST_LINEARIZER( 5, RowMajorStorage )
 
+TEST_MORTON_LINEARIZER( 1 )
+TEST_MORTON_LINEARIZER( 2 )
+TEST_MORTON_LINEARIZER( 3 )
+TEST_MORTON_LINEARIZER( 4 )
+
 BENCH_LINEARIZER( 1, ColMajorStorage )
 BENCH_LINEARIZER( 2, ColMajorStorage )
 BENCH_LINEARIZER( 3, ColMajorStorage )
@@ -26,6 +26,9 @@
 
 #include <limits>
 
+#include <cmath>
+#include <sstream>
+
 #include "DGtal/base/BasicTypes.h"
 #include "DGtal/kernel/NumberTraits.h"
 
@@ -201,3 +204,56 @@ TEST_CASE( "BigInteger" )
 }
 
 #endif
+
+#ifdef WITH_INT128
+
+/// Check traits for the 128-bit integers
+TEST_CASE( "int128_t" )
+{
+  using T = DGtal::int128_t;
+  using U = DGtal::uint128_t;
+  using NT = typename DGtal::NumberTraits<T>;
+  using NU = typename DGtal::NumberTraits<U>;
+
+  REQUIRE_SAME_VALUE( typename NT::IsBounded,     true );
+  REQUIRE_SAME_VALUE( typename NT::IsSigned,      true );
+  REQUIRE_SAME_VALUE( typename NT::IsUnsigned,    false );
+  REQUIRE_SAME_VALUE( typename NT::IsIntegral,    true );
+  REQUIRE_SAME_VALUE( typename NT::IsSpecialized, true );
+  REQUIRE_SAME_VALUE( typename NU::IsSigned,      false );
+  REQUIRE_SAME_VALUE( typename NU::IsUnsigned,    true );
+
+  REQUIRE_SAME_TYPE( typename NT::ReturnType, T );
+  REQUIRE_SAME_TYPE( typename NT::SignedVersion, T );
+  REQUIRE_SAME_TYPE( typename NT::UnsignedVersion, U );
+  REQUIRE_SAME_TYPE( typename NU::SignedVersion, T );
+  REQUIRE_SAME_TYPE( typename std::decay<NT::ParamType>::type, T );
+
+  REQUIRE( NT::zero() == T(0) );
+  REQUIRE( NT::one() == T(1) );
+  REQUIRE( NT::max() == T( ( U(1) << 127 ) - 1 ) );
+  REQUIRE( NT::min() == -NT::max() - 1 );
+  REQUIRE( NU::max() == ~U(0) );
+  REQUIRE( NU::min() == U(0) );
+  REQUIRE( NT::digits() == 127 );
+  REQUIRE( NU::digits() == 128 );
+
+  REQUIRE( NT::even(T(42)) == true );
+  REQUIRE( NT::odd(T(43)) == true );
+  REQUIRE( NT::isBounded() == DGtal::BOUNDED );
+  REQUIRE( NT::isSigned() == DGtal::SIGNED );
+  REQUIRE( NU::isSigned() == DGtal::UNSIGNED );
+
+  REQUIRE( NT::castToInt64_t(T(-3)) == -3 );
+  REQUIRE( NT::castToDouble(T(1) << 100) == std::ldexp(1.0, 100) );
+
+  checkParamRef(NT::ZERO);
+  checkParamRef(NT::ONE);
+
+  std::ostringstream out;
+  out << NT::min() << " " << NU::max() << " " << T(0) << " " << T(-42);
+  REQUIRE( out.str() == "-170141183460469231731687303715884105728 "
+                        "340282366920938463463374607431768211455 0 -42" );
+}
+
+#endif
@@ -521,6 +521,46 @@ TEST_CASE( "4D Point Vector Unit tests" )
 }
 
 
+TEST_CASE( "Point Vector with padded aligned storage" )
+{
+  using Integer = DGtal::int32_t;
+  typedef PointVector<3, Integer> Point;
+  typedef PointVector<3, Integer, PaddedArray<Integer, 3> > PaddedPoint;
+  typedef PointVector<3, double, PaddedArray<double, 3> > PaddedRealPoint;
+
+  SECTION("Storage layout")
+    {
+      REQUIRE( PaddedPoint::Container::paddedSize == 4 );
+      REQUIRE( PaddedPoint::Container().size() == 3 );
+      REQUIRE( alignof( PaddedPoint ) >= PaddedArrayTraits<Integer, 3>::alignment );
+      PaddedPoint p( 1, 2, 3 );
+      REQUIRE( p.data()[ 3 ] == 0 );
+      REQUIRE( std::distance( p.begin(), p.end() ) == 3 );
+    }
+
+  SECTION("Arithmetic matches the default storage")
+    {
+      Point a( 1, -2, 3 ), b( 4, 5, -6 );
+      PaddedPoint pa( 1, -2, 3 ), pb( 4, 5, -6 );
+      PaddedPoint pc = pa + pb;
+      PaddedPoint pd = pa - pb;
+      REQUIRE( pc[0] == ( a + b )[0] );
+      REQUIRE( pc[1] == ( a + b )[1] );
+      REQUIRE( pc[2] == ( a + b )[2] );
+      REQUIRE( pd[0] == ( a - b )[0] );
+      REQUIRE( pd[1] == ( a - b )[1] );
+      REQUIRE( pd[2] == ( a - b )[2] );
+      REQUIRE( pc.data()[ 3 ] == 0 );
+      REQUIRE( pa.dot( pb ) == a.dot( b ) );
+      REQUIRE( pa.inf( pb ) == PaddedPoint( 1, -2, -6 ) );
+      REQUIRE( pa.sup( pb ) == PaddedPoint( 4, 5, 3 ) );
+      REQUIRE( pa.isLower( pa.sup( pb ) ) );
+      PaddedRealPoint r( 0.5, 1.5, 2.0 );
+      REQUIRE( r.dot( r ) == Approx( 6.5 ) );
+      REQUIRE( r.norm() == Approx( std::sqrt( 6.5 ) ) );
+    }
+}
+
 TEST_CASE("Benchmarking","[.benchmark]")
 {
   using Integer = DGtal::int32_t;
@@ -0,0 +1,118 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class PointVectorSoA.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/PointVectorSoA.h"
+#include "DGtal/geometry/tools/SpatialCubicalSubdivision.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PointVectorSoA.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing PointVectorSoA" )
+{
+  typedef Z3i::Point Point;
+  typedef Z3i::RealPoint RealPoint;
+  std::vector<Point> pts;
+  for ( int i = 0; i < 37; ++i )
+    pts.push_back( Point( i % 5 - 2, ( 7 * i ) % 11, -i ) );
+  PointVectorSoA<Point> buffer( pts.begin(), pts.end() );
+
+  SECTION( "Container services" )
+    {
+      REQUIRE( buffer.isValid() );
+      REQUIRE( buffer.size() == pts.size() );
+      for ( std::size_t i = 0; i < pts.size(); ++i )
+        REQUIRE( buffer.point( i ) == pts[ i ] );
+      REQUIRE( buffer.coordinates( 2 )[ 5 ] == -5 );
+      buffer.setPoint( 3, Point( 9, 9, 9 ) );
+      REQUIRE( buffer.point( 3 ) == Point( 9, 9, 9 ) );
+      std::vector<Point> out;
+      buffer.copyTo( out );
+      REQUIRE( out.size() == pts.size() );
+      REQUIRE( out[ 3 ] == Point( 9, 9, 9 ) );
+      buffer.clear();
+      REQUIRE( buffer.empty() );
+    }
+
+  SECTION( "Batched operations" )
+    {
+      Point lo, up;
+      buffer.boundingBox( lo, up );
+      REQUIRE( lo == Point( -2, 0, -36 ) );
+      REQUIRE( up == Point( 2, 10, 0 ) );
+      buffer.translate( Point( 1, 1, 1 ) );
+      for ( std::size_t i = 0; i < pts.size(); ++i )
+        REQUIRE( buffer.point( i ) == pts[ i ] + Point( 1, 1, 1 ) );
+      const Point v( 3, -1, 2 );
+      std::vector<Z3i::Integer> dots;
+      buffer.dotProducts( v, dots );
+      std::vector<double> d2;
+      buffer.squaredDistances( v, d2 );
+      for ( std::size_t i = 0; i < pts.size(); ++i )
+        {
+          const Point p = pts[ i ] + Point( 1, 1, 1 );
+          REQUIRE( dots[ i ] == p.dot( v ) );
+          REQUIRE( d2[ i ] == Approx( RealPoint( p - v ).dot( RealPoint( p - v ) ) ) );
+        }
+    }
+
+  SECTION( "Batched binning in SpatialCubicalSubdivision" )
+    {
+      SpatialCubicalSubdivision<Z3i::Space> one( Point( -2, 0, -36 ), Point( 2, 10, 0 ), 3 );
+      SpatialCubicalSubdivision<Z3i::Space> batch( Point( -2, 0, -36 ), Point( 2, 10, 0 ), 3 );
+      one.push( pts.begin(), pts.end() );
+      batch.push( buffer );
+      const Point blo = one.binDomain().lowerBound();
+      const Point bup = one.binDomain().upperBound();
+      for ( auto b : one.binDomain() )
+        {
+          std::vector<Point> p1, p2;
+          one.getPoints( p1, b, b );
+          batch.getPoints( p2, b, b );
+          REQUIRE( p1 == p2 );
+        }
+      std::vector<Point> sorted_in( pts ), sorted_out;
+      batch.getPoints( sorted_out, blo, bup );
+      REQUIRE( sorted_out.size() == pts.size() );
+      std::sort( sorted_in.begin(), sorted_in.end() );
+      std::sort( sorted_out.begin(), sorted_out.end() );
+      REQUIRE( sorted_in == sorted_out );
+    }
+}
+
+/** @ingroup Tests **/
@@ -35,6 +35,8 @@
 #include <unordered_set>
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/UnorderedSetByBlock.h"
+#include "DGtal/kernel/ShardedUnorderedSetByBlock.h"
+#include "DGtal/base/SetFunctions.h"
 #include "DGtalCatch.h"
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -808,6 +810,90 @@ SCENARIO( "UnorderedSetByBlock< PointVector< 3, int64 > unit tests with 64 bits
 }
 
 
+SCENARIO( "UnorderedSetByBlock< PointVector< 3, int > bulk and block-level set operations", "[unorderedsetbyblock][3d][bulk]" )
+{
+  typedef PointVector< 3, int32_t >        Point;
+  typedef std::unordered_set< Point >      StdUnorderedSet;
+  typedef UnorderedSetByBlock< Point >     BlockUnorderedSet;
+
+  std::vector< Point > sorted, unsorted;
+  for ( int z = -5; z <= 5; z++ )
+    for ( int y = -5; y <= 5; y++ )
+      for ( int x = -40; x <= 40; x++ )
+        if ( ( x * x + 3 * y * y + 7 * z * z ) % 5 != 0 )
+          sorted.push_back( Point( x, y, z ) );
+  for ( int i = 0; i < 2000; i++ )
+    unsorted.push_back( randomPoint<Point>( 30 ) );
+  StdUnorderedSet stdA( sorted.cbegin(), sorted.cend() );
+  StdUnorderedSet stdB( unsorted.cbegin(), unsorted.cend() );
+
+  BlockUnorderedSet A, B, A1;
+  A.insert( sorted.cbegin(), sorted.cend() );
+  B.insert( unsorted.cbegin(), unsorted.cend() );
+  for ( auto&& p : sorted ) A1.insert( p );
+
+  WHEN( "Inserting ranges, sorted or not, the same elements are stored as with element-wise insertion" ) {
+    REQUIRE( A.size() == stdA.size() );
+    REQUIRE( B.size() == stdB.size() );
+    REQUIRE( A.count_elements() == A.size() );
+    REQUIRE( B.count_elements() == B.size() );
+    REQUIRE( A == A1 );
+    unsigned int nb_ok = 0;
+    for ( auto&& p : stdB ) nb_ok += B.count( p );
+    REQUIRE( nb_ok == stdB.size() );
+  }
+  WHEN( "Computing set operations by blocks, the results are the same as with std::unordered_set<>" ) {
+    using namespace functions::setops;
+    BlockUnorderedSet U = A | B;
+    BlockUnorderedSet I = A & B;
+    BlockUnorderedSet D = A - B;
+    BlockUnorderedSet X = A ^ B;
+    StdUnorderedSet   stdU = stdA | stdB;
+    StdUnorderedSet   stdI = stdA & stdB;
+    StdUnorderedSet   stdD = stdA - stdB;
+    StdUnorderedSet   stdX = stdA ^ stdB;
+    REQUIRE( U.size() == stdU.size() );
+    REQUIRE( I.size() == stdI.size() );
+    REQUIRE( D.size() == stdD.size() );
+    REQUIRE( X.size() == stdX.size() );
+    REQUIRE( U.count_elements() == U.size() );
+    REQUIRE( I.count_elements() == I.size() );
+    REQUIRE( D.count_elements() == D.size() );
+    REQUIRE( X.count_elements() == X.size() );
+    unsigned int nb_ok = 0;
+    for ( auto&& p : stdU ) nb_ok += U.count( p );
+    for ( auto&& p : stdI ) nb_ok += I.count( p );
+    for ( auto&& p : stdD ) nb_ok += D.count( p );
+    for ( auto&& p : stdX ) nb_ok += X.count( p );
+    REQUIRE( nb_ok == stdU.size() + stdI.size() + stdD.size() + stdX.size() );
+    REQUIRE( functions::isSubset( I, A ) );
+    REQUIRE( functions::isSubset( B, U ) );
+    REQUIRE( functions::isEqual( ( D | I ), A ) );
+    REQUIRE( ! functions::isEqual( A, B ) );
+  }
+  WHEN( "Populating a sharded set in parallel, merging gives the same set" ) {
+    ShardedUnorderedSetByBlock< Point > shared( 16 );
+    const int nb = static_cast<int>( sorted.size() );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for ( int i = 0; i < nb; i += 100 )
+      shared.insert( sorted.cbegin() + i, sorted.cbegin() + std::min( i + 100, nb ) );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for ( int i = 0; i < static_cast<int>( unsorted.size() ); i++ )
+      shared.insert( unsorted[ i ] );
+    using namespace functions::setops;
+    BlockUnorderedSet U = shared.merge();
+    REQUIRE( shared.size() == U.size() );
+    REQUIRE( U == ( A | B ) );
+    REQUIRE( shared.count( sorted[ 0 ] ) == 1 );
+    REQUIRE( shared.erase( sorted[ 0 ] ) == 1 );
+    REQUIRE( shared.count( sorted[ 0 ] ) == 0 );
+  }
+}
+
 
 //                                                                           //
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,184 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchEigenDecomposition3D.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class BatchEigenDecomposition3D.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/BatchEigenDecomposition3D.h"
+#include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef BatchEigenDecomposition3D<double> Batch;
+typedef Batch::Matrix Matrix;
+typedef Batch::Vector Vector;
+typedef EigenDecomposition<3, double> Reference;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchEigenDecomposition3D.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Random symmetric matrices, some of them with multiple eigenvalues
+/// or diagonal.
+std::vector<Matrix> randomMatrices( unsigned int nb )
+{
+  srand( 0 );
+  std::vector<Matrix> res;
+  for ( unsigned int k = 0; k < nb; ++k )
+    {
+      Matrix m;
+      for ( Dimension i = 0; i < 3; ++i )
+        for ( Dimension j = i; j < 3; ++j )
+          {
+            const double x = ( k % 7 == 3 && i != j )
+              ? 0.0 : ( rand() / double( RAND_MAX ) - 0.5 ) * ( 1 + k % 100 );
+            m.setComponent( i, j, x );
+            m.setComponent( j, i, x );
+          }
+      if ( k % 7 == 5 ) // covariance of points on a segment: rank 1.
+        {
+          const Vector u( rand() % 5 - 2.0, rand() % 5 - 2.0, 1.0 );
+          for ( Dimension i = 0; i < 3; ++i )
+            for ( Dimension j = 0; j < 3; ++j )
+              m.setComponent( i, j, u[ i ] * u[ j ] );
+        }
+      res.push_back( m );
+    }
+  return res;
+}
+
+/// Checks the decomposition of @a m against the one of
+/// EigenDecomposition.
+void checkDecomposition( const Matrix & m, const Matrix & vectors, const Vector & values )
+{
+  Matrix refVectors;
+  Vector refValues;
+  Reference::getEigenDecomposition( m, refVectors, refValues );
+  double scale = 0.0;
+  for ( Dimension i = 0; i < 3; ++i )
+    scale = std::max( scale, std::abs( refValues[ i ] ) );
+  const double eps = 1e-12 * std::max( scale, 1.0 );
+  for ( Dimension i = 0; i < 3; ++i )
+    {
+      REQUIRE( std::abs( values[ i ] - refValues[ i ] ) <= eps );
+      const Vector v = vectors.column( i );
+      REQUIRE( v.norm() == Approx( 1.0 ) );
+      // m v = lambda v
+      REQUIRE( ( m * v - values[ i ] * v ).norm() <= eps );
+      // orthonormal basis
+      for ( Dimension j = i + 1; j < 3; ++j )
+        REQUIRE( std::abs( v.dot( vectors.column( j ) ) ) <= 1e-12 );
+      // simple eigenvalues have the same eigenvectors, up to their sign.
+      const bool simple = ( i == 0 || refValues[ i ] - refValues[ i - 1 ] > 1e-6 * scale )
+        && ( i == 2 || refValues[ i + 1 ] - refValues[ i ] > 1e-6 * scale );
+      if ( simple )
+        REQUIRE( std::abs( v.dot( refVectors.column( i ) ) ) == Approx( 1.0 ) );
+    }
+}
+
+TEST_CASE( "Batch of 3x3 symmetric eigen decompositions", "[batcheigendecomposition3d]" )
+{
+  const std::vector<Matrix> matrices = randomMatrices( 1003 );
+  Batch batch;
+  batch.compute( matrices, 1 );
+  REQUIRE( batch.isValid() );
+  REQUIRE( batch.size() == matrices.size() );
+  REQUIRE( batch.nbSweeps() > 0 );
+  REQUIRE( batch.nbSweeps() < Batch::maxNbSweeps );
+  for ( Batch::Index k = 0; k < batch.size(); ++k )
+    {
+      INFO( "matrix " << k << " " << matrices[ k ] );
+      Matrix vectors;
+      Vector values;
+      batch.getEigenDecomposition( k, vectors, values );
+      REQUIRE( values == batch.eigenValues( k ) );
+      REQUIRE( vectors == batch.eigenVectors( k ) );
+      REQUIRE( values[ 0 ] <= values[ 1 ] );
+      REQUIRE( values[ 1 ] <= values[ 2 ] );
+      checkDecomposition( matrices[ k ], vectors, values );
+
+      // A single matrix gives the same result.
+      Matrix singleVectors;
+      Vector singleValues;
+      Batch::getEigenDecomposition( matrices[ k ], singleVectors, singleValues );
+      checkDecomposition( matrices[ k ], singleVectors, singleValues );
+    }
+
+  // The result does not depend on the number of blocks.
+  for ( unsigned int nbBlocks : { 0u, 3u, 64u, 1000u } )
+    {
+      Batch other;
+      other.compute( matrices, nbBlocks );
+      for ( Dimension i = 0; i < 3; ++i )
+        {
+          REQUIRE( other.values( i ) == batch.values( i ) );
+          for ( Dimension j = 0; j < 3; ++j )
+            REQUIRE( other.vectors( i, j ) == batch.vectors( i, j ) );
+        }
+    }
+}
+
+TEST_CASE( "Degenerate 3x3 symmetric matrices", "[batcheigendecomposition3d]" )
+{
+  // null matrix, diagonal matrix, identity, the 3x3 Hilbert matrix
+  // with coefficients 1/(i+j+1).
+  const Batch::Components xx = { 0.0, 3.0, 1.0, 1.0 };
+  const Batch::Components xy = { 0.0, 0.0, 0.0, 1.0 / 2.0 };
+  const Batch::Components xz = { 0.0, 0.0, 0.0, 1.0 / 3.0 };
+  const Batch::Components yy = { 0.0, -1.0, 1.0, 1.0 / 3.0 };
+  const Batch::Components yz = { 0.0, 0.0, 0.0, 1.0 / 4.0 };
+  const Batch::Components zz = { 0.0, 2.0, 1.0, 1.0 / 5.0 };
+  Batch batch;
+  batch.compute( xx, xy, xz, yy, yz, zz );
+  REQUIRE( batch.size() == 4 );
+  REQUIRE( batch.eigenValues( 0 ) == Vector( 0.0, 0.0, 0.0 ) );
+  REQUIRE( batch.eigenValues( 1 ) == Vector( -1.0, 2.0, 3.0 ) );
+  REQUIRE( batch.eigenVectors( 1 ).column( 0 ) == Vector( 0.0, 1.0, 0.0 ) );
+  REQUIRE( batch.eigenVectors( 1 ).column( 1 ) == Vector( 0.0, 0.0, 1.0 ) );
+  REQUIRE( batch.eigenVectors( 1 ).column( 2 ) == Vector( 1.0, 0.0, 0.0 ) );
+  REQUIRE( batch.eigenValues( 2 ) == Vector( 1.0, 1.0, 1.0 ) );
+  Matrix hilbert;
+  for ( Dimension i = 0; i < 3; ++i )
+    for ( Dimension j = 0; j < 3; ++j )
+      hilbert.setComponent( i, j, 1.0 / ( i + j + 1 ) );
+  checkDecomposition( hilbert, batch.eigenVectors( 3 ), batch.eigenValues( 3 ) );
+
+  Batch none;
+  none.compute( Batch::Components(), Batch::Components(), Batch::Components(),
+                Batch::Components(), Batch::Components(), Batch::Components() );
+  REQUIRE( none.size() == 0 );
+  REQUIRE( none.isValid() );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
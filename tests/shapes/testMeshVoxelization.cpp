@@ -232,4 +232,32 @@ TEST_CASE("Basic voxelization test", "[voxelization]")
     //hard coded test.
     REQUIRE( outputSet.size() == 4162 );
   }
+  // ---------------------------------------------------------
+  SECTION("Solid voxelization of a OFF cube mesh")
+  {
+    //Importing OFF mesh
+    Mesh<Z3i::RealPoint> inputMesh;
+    MeshReader<Z3i::RealPoint>::importOFFFile(testPath +"/samples/box.off" , inputMesh);
+    Z3i::Domain domain( Point().diagonal(-30), Point().diagonal(30));
+    DigitalSet surfaceSet(domain);
+    DigitalSet solidSet(domain);
+    MeshVoxelizer6 voxelizer;
+
+    voxelizer.voxelize(surfaceSet, inputMesh, 10.0 );
+    voxelizer.voxelizeSolid(solidSet, inputMesh, 10.0 );
+
+    // the box is |x|+|y| <= 16.33, |z| <= 11.55: the solid set is the
+    // surface set and the voxels inside the box.
+    unsigned int nbInside = 0;
+    unsigned int nbSolid  = 0;
+    for(auto p: domain)
+    {
+      const bool inside = std::abs(p[0]) + std::abs(p[1]) <= 16 && std::abs(p[2]) <= 11;
+      nbInside += inside ? 1 : 0;
+      REQUIRE( solidSet(p) == ( inside || surfaceSet(p) ) );
+      nbSolid += ( inside || surfaceSet(p) ) ? 1 : 0;
+    }
+    REQUIRE( nbInside == 12535 );
+    REQUIRE( solidSet.size() == nbSolid );
+  }
 }
@@ -31,6 +31,8 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <set>
+#include <map>
 #include "DGtal/base/Common.h"
 #include "ConfigTest.h"
 #include "DGtalCatch.h"
@@ -307,3 +309,100 @@ SCENARIO( "SurfaceMesh< RealPoint3 > reader/writer tests", "[surfmesh][io]" )
     }
   }
 }
+
+SCENARIO( "SurfaceMesh< RealPoint3 > packed connectivity tests", "[surfmesh][connectivity]" )
+{
+  typedef PointVector<3,double>                 RealPoint;
+  typedef PointVector<3,double>                 RealVector;
+  typedef SurfaceMesh< RealPoint, RealVector >  PolygonMesh;
+  typedef PolygonMesh::Vertices                 Vertices;
+  typedef PolygonMesh::Faces                    Faces;
+  typedef PolygonMesh::Index                    Index;
+  typedef PolygonMesh::VertexPair               VertexPair;
+  // A polygon soup with non manifold edges, faces with repeated
+  // vertices and isolated vertices.
+  srand( 0 );
+  const Index nbv = 30;
+  std::vector< RealPoint > positions( nbv );
+  std::vector< Vertices  > faces;
+  for ( int f = 0; f < 80; ++f )
+    {
+      Vertices face;
+      const int n = 2 + rand() % 4;
+      for ( int k = 0; k < n; ++k ) face.push_back( rand() % ( nbv - 2 ) );
+      faces.push_back( face );
+    }
+  PolygonMesh polymesh( positions.cbegin(), positions.cend(),
+                        faces.cbegin(), faces.cend() );
+  // Connectivity computed naively.
+  std::vector< Faces > incident_faces( nbv );
+  std::vector< std::set< Index > > neighbor_vertices( nbv );
+  std::map< VertexPair, Faces > left_faces, right_faces;
+  for ( Index f = 0; f < faces.size(); ++f )
+    {
+      const Vertices& face = faces[ f ];
+      for ( Index k = 0; k < face.size(); ++k )
+        {
+          const Index i = face[ k ];
+          const Index j = face[ ( k + 1 ) % face.size() ];
+          incident_faces[ i ].push_back( f );
+          neighbor_vertices[ i ].insert( j );
+          neighbor_vertices[ j ].insert( i );
+          if ( i < j ) left_faces [ std::make_pair( i, j ) ].push_back( f );
+          else         right_faces[ std::make_pair( j, i ) ].push_back( f );
+        }
+    }
+  std::set< VertexPair > edges;
+  for ( auto ef : left_faces  ) edges.insert( ef.first );
+  for ( auto ef : right_faces ) edges.insert( ef.first );
+  THEN( "Vertices have their incident faces and neighbors" ) {
+    REQUIRE( polymesh.nbVertices() == nbv );
+    REQUIRE( polymesh.incidentFaces( nbv - 1 ).empty() );
+    for ( Index v = 0; v < nbv; ++v )
+      {
+        REQUIRE( Faces( polymesh.incidentFaces( v ) ) == incident_faces[ v ] );
+        REQUIRE( Vertices( polymesh.neighborVertices( v ) )
+                 == Vertices( neighbor_vertices[ v ].cbegin(), neighbor_vertices[ v ].cend() ) );
+      }
+  }
+  THEN( "Faces have their vertices and the faces sharing two vertices as neighbors" ) {
+    REQUIRE( polymesh.nbFaces() == faces.size() );
+    for ( Index f = 0; f < faces.size(); ++f )
+      {
+        REQUIRE( polymesh.incidentVertices( f ) == polymesh.allIncidentVertices()[ f ] );
+        REQUIRE( Vertices( polymesh.incidentVertices( f ) ) == faces[ f ] );
+        Vertices sf = faces[ f ];
+        std::sort( sf.begin(), sf.end() );
+        Faces neighbors;
+        for ( Index g = 0; g < faces.size(); ++g )
+          {
+            Vertices sg = faces[ g ], common;
+            std::sort( sg.begin(), sg.end() );
+            std::set_intersection( sf.cbegin(), sf.cend(), sg.cbegin(), sg.cend(),
+                                   std::back_inserter( common ) );
+            if ( g != f && common.size() == 2 ) neighbors.push_back( g );
+          }
+        REQUIRE( Faces( polymesh.neighborFaces( f ) ) == neighbors );
+      }
+  }
+  THEN( "Edges are sorted and have their left and right faces" ) {
+    REQUIRE( polymesh.nbEdges() == edges.size() );
+    Index e = 0;
+    for ( auto vp : edges )
+      {
+        REQUIRE( polymesh.edgeVertices( e ) == vp );
+        REQUIRE( polymesh.makeEdge( vp.first, vp.second ) == e );
+        REQUIRE( polymesh.makeEdge( vp.second, vp.first ) == e );
+        const Faces& lf = left_faces [ vp ];
+        const Faces& rf = right_faces[ vp ];
+        Faces all = rf;
+        all.insert( all.end(), lf.cbegin(), lf.cend() );
+        REQUIRE( Faces( polymesh.edgeLeftFaces( e ) )  == lf );
+        REQUIRE( Faces( polymesh.edgeRightFaces( e ) ) == rf );
+        REQUIRE( Faces( polymesh.edgeFaces( e ) )      == all );
+        ++e;
+      }
+    REQUIRE( polymesh.makeEdge( nbv - 1, 0 ) == polymesh.nbEdges() );
+    REQUIRE( polymesh.makeEdge( nbv + 3, 0 ) == polymesh.nbEdges() );
+  }
+}
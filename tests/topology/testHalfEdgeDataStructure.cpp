@@ -389,6 +389,64 @@ SCENARIO( "HalfEdgeDataStructure build", "[halfedge][build]" )
       REQUIRE( bdry.size() == 6 );
     }
   }
+  GIVEN( "A triangulated torus of 30x20 quads with shuffled vertex indices" ) {
+    const Size n = 30;
+    const Size m = 20;
+    std::vector< Size > perm( n * m );
+    for ( Size i = 0; i < perm.size(); ++i ) perm[ i ] = ( 7 * i + 3 ) % perm.size();
+    auto V = [&] ( Size i, Size j ) { return perm[ ( i % n ) * m + ( j % m ) ]; };
+    std::vector< Triangle >      triangles;
+    std::vector< PolygonalFace > quads;
+    for ( Size i = 0; i < n; ++i )
+      for ( Size j = 0; j < m; ++j )
+        {
+          triangles.push_back( Triangle( V(i,j), V(i+1,j), V(i+1,j+1) ) );
+          triangles.push_back( Triangle( V(i,j), V(i+1,j+1), V(i,j+1) ) );
+          quads.push_back( { V(i,j), V(i+1,j), V(i+1,j+1), V(i,j+1) } );
+        }
+    HalfEdgeDataStructure mesh;
+    HalfEdgeDataStructure qmesh;
+    std::vector< Edge > edges;
+    const Size nbv = HalfEdgeDataStructure::getUnorderedEdgesFromTriangles( triangles, edges );
+    THEN( "The edges are sorted without duplicates" ) {
+      REQUIRE( nbv == n * m );
+      REQUIRE( edges.size() == 3 * n * m );
+      for ( Size e = 1; e < edges.size(); ++e )
+        REQUIRE( edges[ e - 1 ] < edges[ e ] );
+    }
+    THEN( "The meshes are valid closed surfaces of Euler characteristic 0" ) {
+      REQUIRE( mesh.build( triangles ) );
+      REQUIRE( mesh.isValid() );
+      REQUIRE( mesh.isValidTriangulation() );
+      REQUIRE( mesh.nbEdges() == 3 * n * m );
+      REQUIRE( mesh.Euler() == 0 );
+      REQUIRE( mesh.boundaryVertices().empty() );
+      REQUIRE( qmesh.build( quads ) );
+      REQUIRE( qmesh.isValid() );
+      REQUIRE( qmesh.nbEdges() == 2 * n * m );
+      REQUIRE( qmesh.Euler() == 0 );
+    }
+    THEN( "Half-edges follow the face vertices" ) {
+      REQUIRE( qmesh.build( quads ) );
+      for ( Size f = 0; f < quads.size(); ++f )
+        for ( Size k = 0; k < 4; ++k )
+          {
+            const auto i = qmesh.halfEdgeIndexFromArc( quads[ f ][ k ], quads[ f ][ ( k + 1 ) % 4 ] );
+            REQUIRE( i != HALF_EDGE_INVALID_INDEX );
+            REQUIRE( qmesh.halfEdge( i ).face == f );
+            REQUIRE( qmesh.halfEdge( i ).next
+                     == qmesh.halfEdgeIndexFromArc( quads[ f ][ ( k + 1 ) % 4 ],
+                                                    quads[ f ][ ( k + 2 ) % 4 ] ) );
+          }
+    }
+  }
+  GIVEN( "Two triangles sharing an arc" ) {
+    std::vector< Triangle > triangles = { Triangle( 0, 1, 2 ), Triangle( 3, 1, 2 ) };
+    HalfEdgeDataStructure mesh;
+    THEN( "The mesh cannot be built" ) {
+      REQUIRE( ! mesh.build( triangles ) );
+    }
+  }
 
 }
 
@@ -0,0 +1,190 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testRasterContourFollower.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/19
+ *
+ * Functions for testing class RasterContourFollower.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/helpers/RasterContourFollower.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace Z2i;
+
+typedef RasterContourFollower<KSpace> Follower;
+typedef std::vector<Point> Contour;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class RasterContourFollower.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Rotates a closed sequence of points to its smallest rotation.
+Contour normalize( const Contour & c )
+{
+  Contour best = c;
+  for ( std::size_t k = 1; k < c.size(); ++k )
+    {
+      Contour r( c.begin() + k, c.end() );
+      r.insert( r.end(), c.begin(), c.begin() + k );
+      if ( std::lexicographical_compare( r.begin(), r.end(), best.begin(), best.end() ) )
+        best = r;
+    }
+  return best;
+}
+
+/// The contours tracked by Surfaces, as sorted normalized pointel sequences.
+template <typename PointPredicate>
+std::vector<Contour> referenceContours( const KSpace & K, const SurfelAdjacency<2> & adj,
+                                        const PointPredicate & pp )
+{
+  std::vector< std::vector<SCell> > surfelContours;
+  Surfaces<KSpace>::extractAll2DSCellContours( surfelContours, K, adj, pp );
+  std::vector<Contour> result;
+  for ( auto && sc : surfelContours )
+    {
+      Contour c;
+      for ( auto && s : sc )
+        c.push_back( K.sCoords( K.sIndirectIncident( s, *K.sDirs( s ) ) ) );
+      result.push_back( normalize( c ) );
+    }
+  std::sort( result.begin(), result.end() );
+  return result;
+}
+
+/// The Freeman chains as sorted normalized pointel sequences.
+std::vector<Contour> chainContours( const std::vector< Follower::Chain > & chains )
+{
+  std::vector<Contour> result;
+  for ( auto && fc : chains )
+    {
+      Contour c;
+      for ( auto it = fc.begin(), itEnd = fc.end(); it != itEnd; ++it )
+        c.push_back( *it );
+      REQUIRE( c.front() == c.back() );
+      c.pop_back();
+      result.push_back( normalize( c ) );
+    }
+  std::sort( result.begin(), result.end() );
+  return result;
+}
+
+TEST_CASE( "Contours of random shapes", "[contours]" )
+{
+  const Domain domain( Point( -3, 2 ), Point( 45, 37 ) );
+  DigitalSet shape( domain );
+  srand( 0 );
+  const Point innerLower = domain.lowerBound() + Point::diagonal( 2 );
+  const Point innerUpper = domain.upperBound() - Point::diagonal( 2 );
+  for ( auto && p : Domain( innerLower, innerUpper ) )
+    if ( ( rand() % 100 ) < 50 ) shape.insertNew( p );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+
+  for ( bool interior : { true, false } )
+    {
+      const SurfelAdjacency<2> adj( interior );
+      const std::vector<Contour> expected = referenceContours( K, adj, shape );
+      std::vector< Follower::Chain > reference;
+      Follower::extractAllFreemanChains( reference, K, adj, shape, 1 );
+      REQUIRE( chainContours( reference ) == expected );
+      for ( std::size_t k = 1; k < reference.size(); ++k )
+        REQUIRE( Point( reference[ k - 1 ].x0, reference[ k - 1 ].y0 )[ 1 ]
+                 <= Point( reference[ k ].x0, reference[ k ].y0 )[ 1 ] );
+      for ( unsigned int nbStrips : { 2u, 3u, 5u, 17u, 1000u } )
+        {
+          std::vector< Follower::Chain > chains;
+          Follower::extractAllFreemanChains( chains, K, adj, shape, nbStrips );
+          REQUIRE( chains.size() == reference.size() );
+          for ( std::size_t k = 0; k < chains.size(); ++k )
+            {
+              REQUIRE( chains[ k ].chain == reference[ k ].chain );
+              REQUIRE( chains[ k ].x0 == reference[ k ].x0 );
+              REQUIRE( chains[ k ].y0 == reference[ k ].y0 );
+            }
+        }
+    }
+}
+
+TEST_CASE( "Contours of shapes touching the bounds", "[contours]" )
+{
+  const Domain domain( Point( 0, 0 ), Point( 4, 2 ) );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  // the whole domain but pixel (2,1), which is a hole.
+  DigitalSet shape( domain );
+  shape.assignFromComplement( DigitalSet( domain ) );
+  shape.erase( Point( 2, 1 ) );
+
+  std::vector< Follower::Chain > chains;
+  Follower::extractAllFreemanChains( chains, K, SurfelAdjacency<2>( true ), shape, 2 );
+  REQUIRE( chains.size() == 2 );
+  // outer contour, counterclockwise from the lowest linel.
+  REQUIRE( chains[ 0 ].chain == "0000011122222333" );
+  REQUIRE( chains[ 0 ].x0 == 0 );
+  REQUIRE( chains[ 0 ].y0 == 0 );
+  // hole contour, clockwise.
+  REQUIRE( chains[ 1 ].chain == "1032" );
+  REQUIRE( chains[ 1 ].x0 == 2 );
+  REQUIRE( chains[ 1 ].y0 == 1 );
+
+  std::vector< Follower::Curve > curves;
+  Follower::extractAllGridCurves( curves, K, SurfelAdjacency<2>( true ), shape );
+  REQUIRE( curves.size() == 2 );
+  REQUIRE( curves[ 0 ].isClosed() );
+  REQUIRE( curves[ 0 ].size() == 16 );
+  REQUIRE( curves[ 1 ].isClosed() );
+  REQUIRE( curves[ 1 ].size() == 4 );
+}
+
+TEST_CASE( "Contours of diagonal pixels", "[contours]" )
+{
+  const Domain domain( Point( 0, 0 ), Point( 3, 3 ) );
+  KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  DigitalSet shape( domain );
+  shape.insertNew( Point( 1, 1 ) );
+  shape.insertNew( Point( 2, 2 ) );
+  std::vector< Follower::Chain > chains;
+  // separated pixels with the interior adjacency
+  Follower::extractAllFreemanChains( chains, K, SurfelAdjacency<2>( true ), shape );
+  REQUIRE( chains.size() == 2 );
+  REQUIRE( chains[ 0 ].chain == "0123" );
+  REQUIRE( chains[ 1 ].chain == "0123" );
+  // one contour with the exterior adjacency
+  Follower::extractAllFreemanChains( chains, K, SurfelAdjacency<2>( false ), shape );
+  REQUIRE( chains.size() == 1 );
+  REQUIRE( chains[ 0 ].chain == "01012323" );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////